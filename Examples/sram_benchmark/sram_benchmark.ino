@@ -0,0 +1,122 @@
+/*******************************************************************************************************************
+** Example program measuring the transfer speed of the MicrochipSRAM library                                      **
+**                                                                                                                **
+** A buffer of BUFFER_BYTES bytes is written to and read from the memory repeatedly, first by sending one byte    **
+** per SPI.transfer() call in the way that the library did up to version 1.0.3 and then by using the get() and    **
+** put() methods, which transfer the whole buffer in blocks. The throughput of each in bytes per second is shown  **
+** on the serial monitor. The same transfers are then done with putAsync() and getAsync(), counting how often a   **
+** work loop runs while waiting for them to finish. This is 0 on processors where the transfers are blocking.     **
+** Next the whole memory is cleared byte-by-byte as clearMemory() did up to version 1.0.13, then using            **
+** clearMemory(), which sends blocks, and a BUFFER_BYTES region is cleared repeatedly using the ranged            **
+** clearMemory(). Finally the average time taken by put() for a small uint16_t value is shown, which is mostly    **
+** made up of the command overhead and selecting and deselecting the chip using the CS/SS pin.                    **
+**                                                                                                                **
+** This program is free software: you can redistribute it and/or modify it under the terms of the GNU General     **
+** Public License as published by the Free Software Foundation, either version 3 of the License, or (at your      **
+** option) any later version. This program is distributed in the hope that it will be useful, but WITHOUT ANY     **
+** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the   **
+** GNU General Public License for more details. You should have received a copy of the GNU General Public License **
+** along with this program.  If not, see <http://www.gnu.org/licenses/>.                                          **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the library              //
+#define SRAM_SS_PIN  A5                                                       // Pin 2 for SPI.Change if necessary//
+#define BUFFER_BYTES 1024                                                     // Size of the buffer to transfer   //
+#define ITERATIONS   16                                                       // Number of transfers to time      //
+#define SMALL_PUTS   1000                                                     // Number of small puts to time     //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+                                                                              //----------------------------------//
+uint8_t buffer[BUFFER_BYTES];                                                 // Buffer to transfer               //
+                                                                              //----------------------------------//
+void byteCommand(const uint8_t command) {                                     // Send command and address 0 using //
+  SPI.beginTransaction(SPISettings(SRAM_SPI_CLOCK,MSBFIRST,SPI_MODE0));       // one SPI.transfer() per byte as   //
+  digitalWrite(SRAM_SS_PIN,LOW);                                              // the library did up to v1.0.3,    //
+  SPI.transfer(command);                                                      // at the same SPI clock speed      //
+  if (memory.SRAMBytes==SRAM_1024) SPI.transfer(0x00);                        //                                  //
+  SPI.transfer(0x00);                                                         //                                  //
+  SPI.transfer(0x00);                                                         //                                  //
+} // of method byteCommand                                                    //----------------------------------//
+void printRate(const char* title, const uint32_t startMicros,                 // Show the bytes per second        //
+               const uint32_t bytes = (uint32_t)BUFFER_BYTES*ITERATIONS) {    //                                  //
+  uint32_t elapsed = micros()-startMicros;                                    //                                  //
+  if (elapsed==0) elapsed = 1;                                                //                                  //
+  Serial.print(title);                                                        //                                  //
+  Serial.print((uint32_t)((uint64_t)bytes*1000000/elapsed));                  //                                  //
+  Serial.print(" bytes/second\n");                                            //                                  //
+} // of method printRate                                                      //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  #ifdef  __AVR_ATmega32U4__                                                  // If this is a 32U4 processor, then//
+    delay(3000);                                                              // wait 3 seconds for the           //
+  #endif                                                                      // serial interface to initialize   //
+  Serial.println("Starting Microchip SRAM benchmark program");                //                                  //
+  if (memory.SRAMBytes==0) {                                                  //----------------------------------//
+    Serial.print("- Error detecting SPI memory.\n");
+    return;
+  } // of if-then no chip was detected
+  for (uint16_t i=0;i<BUFFER_BYTES;i++) buffer[i] = i;
+  uint32_t startMicros = micros();
+  for (uint8_t j=0;j<ITERATIONS;j++) {
+    byteCommand(SRAM_WRITE_CODE);
+    for (uint16_t i=0;i<BUFFER_BYTES;i++) SPI.transfer(buffer[i]);
+    digitalWrite(SRAM_SS_PIN,HIGH);
+    SPI.endTransaction();
+  } // of for-next each iteration
+  printRate("Byte-by-byte write: ",startMicros);
+  startMicros = micros();
+  for (uint8_t j=0;j<ITERATIONS;j++) {
+    byteCommand(SRAM_READ_CODE);
+    for (uint16_t i=0;i<BUFFER_BYTES;i++) buffer[i] = SPI.transfer(0x00);
+    digitalWrite(SRAM_SS_PIN,HIGH);
+    SPI.endTransaction();
+  } // of for-next each iteration
+  printRate("Byte-by-byte read:  ",startMicros);
+  startMicros = micros();
+  for (uint8_t j=0;j<ITERATIONS;j++) memory.put(0,buffer);
+  printRate("Block put():        ",startMicros);
+  startMicros = micros();
+  for (uint8_t j=0;j<ITERATIONS;j++) memory.get(0,buffer);
+  printRate("Block get():        ",startMicros);
+  uint32_t workLoops = 0;
+  startMicros = micros();
+  for (uint8_t j=0;j<ITERATIONS;j++) {
+    MicrochipSRAM::AsyncTransfer transfer = memory.putAsync(0,buffer);
+    while (!transfer.done()) workLoops++; // other work can be done here
+  } // of for-next each iteration
+  printRate("Async putAsync():   ",startMicros);
+  startMicros = micros();
+  for (uint8_t j=0;j<ITERATIONS;j++) {
+    MicrochipSRAM::AsyncTransfer transfer = memory.getAsync(0,buffer);
+    while (!transfer.done()) workLoops++; // other work can be done here
+  } // of for-next each iteration
+  printRate("Async getAsync():   ",startMicros);
+  Serial.print("Work loops during async transfers: ");
+  Serial.println(workLoops);
+  startMicros = micros();
+  byteCommand(SRAM_WRITE_CODE);
+  for (uint32_t i=0;i<memory.SRAMBytes;i++) SPI.transfer(0x00);
+  digitalWrite(SRAM_SS_PIN,HIGH);
+  SPI.endTransaction();
+  printRate("Byte-by-byte clear: ",startMicros,memory.SRAMBytes);
+  startMicros = micros();
+  memory.clearMemory();
+  printRate("clearMemory():      ",startMicros,memory.SRAMBytes);
+  startMicros = micros();
+  for (uint8_t j=0;j<ITERATIONS;j++) memory.clearMemory(0,BUFFER_BYTES);
+  printRate("Ranged clearMemory: ",startMicros);
+  uint16_t smallValue = 0;
+  startMicros = micros();
+  for (uint16_t i=0;i<SMALL_PUTS;i++) memory.put(i*sizeof(smallValue),smallValue);
+  Serial.print("Small put() latency: ");
+  Serial.print((float)(micros()-startMicros)/SMALL_PUTS,2);
+  Serial.print(" microseconds\n");
+  startMicros = micros();
+  for (uint16_t i=0;i<SMALL_PUTS;i++) memory.get(i*sizeof(smallValue),smallValue);
+  printRate("Sample get():       ",startMicros,SMALL_PUTS*sizeof(smallValue));
+  startMicros = micros();
+  SRAMReader<> reader(memory,0); // one transaction for all samples
+  for (uint16_t i=0;i<SMALL_PUTS;i++) reader.read(smallValue);
+  reader.end();
+  printRate("Sample SRAMReader:  ",startMicros,SMALL_PUTS*sizeof(smallValue));
+} // of method setup()
+
+void loop() { while(1); } // do nothing in the main loop
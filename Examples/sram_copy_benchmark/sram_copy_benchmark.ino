@@ -0,0 +1,69 @@
+/*******************************************************************************************************************
+** Example program measuring the speed of copying data from one memory chip to another using the MicrochipSRAM    **
+** library                                                                                                        **
+**                                                                                                                **
+** Two memory chips share the SPI bus, using the CS/SS pins SRAM_SS_PIN and SRAM2_SS_PIN. A region of COPY_BYTES  **
+** bytes is copied from the first chip to the second, first by reading and writing one uint32_t value at a time   **
+** using get() and put() and then using copyTo(), which moves the data in chunks of SRAM_COPY_BYTES bytes. The    **
+** throughput of each in bytes per second is shown on the serial monitor and the copy is checked. On a PC the     **
+** program can be run using the emulator in extras/host by adding "-DHOST_SRAM2_PIN=10" to the build command      **
+** shown in host_main.cpp.                                                                                        **
+**                                                                                                                **
+** This program is free software: you can redistribute it and/or modify it under the terms of the GNU General     **
+** Public License as published by the Free Software Foundation, either version 3 of the License, or (at your      **
+** option) any later version. This program is distributed in the hope that it will be useful, but WITHOUT ANY     **
+** WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the   **
+** GNU General Public License for more details. You should have received a copy of the GNU General Public License **
+** along with this program.  If not, see <http://www.gnu.org/licenses/>.                                          **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the library              //
+#define SRAM_SS_PIN  A5                                                       // CS/SS pin of the first memory    //
+#define SRAM2_SS_PIN 10                                                       // CS/SS pin of the second memory   //
+#define COPY_BYTES   4096                                                     // Size of the region to copy       //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory copied    //
+static MicrochipSRAM memory2(SRAM2_SS_PIN);                                   // from and the one copied to       //
+                                                                              //----------------------------------//
+void printRate(const char* title, const uint32_t startMicros) {               // Show the bytes per second        //
+  uint32_t elapsed = micros()-startMicros;                                    //                                  //
+  if (elapsed==0) elapsed = 1;                                                //                                  //
+  Serial.print(title);                                                        //                                  //
+  Serial.print((uint32_t)((uint64_t)COPY_BYTES*1000000/elapsed));             //                                  //
+  Serial.print(" bytes/second\n");                                            //                                  //
+} // of method printRate                                                      //----------------------------------//
+bool checkCopy() {                                                            // True if the copy is identical    //
+  uint32_t value, value2;                                                     //                                  //
+  for (uint32_t i=0;i<COPY_BYTES;i+=sizeof(value)) {                          //                                  //
+    memory.get(i,value);                                                      //                                  //
+    memory2.get(i,value2);                                                    //                                  //
+    if (value!=value2) return false;                                          //                                  //
+  } // of for-next each value                                                 //                                  //
+  return true;                                                                //                                  //
+} // of method checkCopy                                                      //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  #ifdef  __AVR_ATmega32U4__                                                  // If this is a 32U4 processor, then//
+    delay(3000);                                                              // wait 3 seconds for the           //
+  #endif                                                                      // serial interface to initialize   //
+  Serial.println("Starting Microchip SRAM copy benchmark program");           //                                  //
+  if (memory.SRAMBytes<COPY_BYTES || memory2.SRAMBytes<COPY_BYTES) {          //----------------------------------//
+    Serial.print("- Error detecting both SPI memories.\n");
+    return;
+  } // of if-then a chip wasn't detected
+  for (uint32_t i=0;i<COPY_BYTES;i+=sizeof(i)) memory.put(i,i*2654435761UL);
+  memory2.clearMemory(0,COPY_BYTES);
+  uint32_t value;
+  uint32_t startMicros = micros();
+  for (uint32_t i=0;i<COPY_BYTES;i+=sizeof(value)) {
+    memory.get(i,value);
+    memory2.put(i,value);
+  } // of for-next each value
+  printRate("get()/put() loop: ",startMicros);
+  if (!checkCopy()) Serial.print("- Error: get()/put() copy differs\n");
+  memory2.clearMemory(0,COPY_BYTES);
+  startMicros = micros();
+  memory.copyTo(memory2,0,0,COPY_BYTES);
+  printRate("copyTo():         ",startMicros);
+  if (!checkCopy()) Serial.print("- Error: copyTo() copy differs\n");
+} // of method setup()
+
+void loop() { while(1); } // do nothing in the main loop
@@ -6,18 +6,20 @@
 ** The library contains the constructor, which requires the CS/SS pin number as input and returns the size, in    **
 ** bytes, of the specific Microchip SPI SRAM chip detected. If a zero is returned it means that no chip was       **
 ** detected which could be caused by either an incorrect CS/SS pin number, or incorrect wiring or no chip.        **
+** The constructor optionally also takes the SPI clock speed (default 20MHz), bit order and SPI mode to use.      **
 **                                                                                                                **
-** There are only 3 methods in the library:                                                                       **
+** The 3 main methods of the library are:                                                                         **
 **                                                                                                                **
 ** [optional uint32 return address] get ( address, {variable} )                                                   **
 ** [optional uint32 return address] put ( address, {variable} )                                                   **
-**                           fillMemory ( address, {variable} )                                                   **
+** [optional uint32 return address] fillMemory ( address, {variable} [, count] )                                  **
 ** If the address is higher than the actual amount of memory bytes availabe it automatically overflows and starts **
 ** back at the beginning of memory, i.e. a 256kbit chip (23x256) stores 32768 bytes. If one puts 2 bytes starting **
 ** at 32767 then byte 0 of the array is overwritten. Get and Put will word wrap from the end to the beginning.    **
 **                                                                                                                **
-** fillMemory will place identical copies of the {variable} starting at the memory position specified to the end  **
-** of memory. Any partial entry at the end of memory will not be filled.                                          **
+** fillMemory will place "count" identical copies of the {variable} starting at the memory position specified,    **
+** or if no count is given as many as fit up to the end of memory. Any partial entry at the end of memory will    **
+** not be filled.                                                                                                 **
 **                                                                                                                **
 ** This program is free software: you can redistribute it and/or modify it under the terms of the GNU General     **
 ** Public License as published by the Free Software Foundation, either version 3 of the License, or (at your      **
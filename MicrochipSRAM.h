@@ -42,6 +42,66 @@
 **                                                                                                                **
 ** Vers.  Date       Developer                     Comments                                                       **
 ** ====== ========== ============================= ============================================================== **
+** 1.0.33 2026-10-16 https://github.com/SV-Zanshin putv() takes SRAMConstSegment lists, so constant buffers are   **
+**                                                 written without a cast                                         **
+** 1.0.32 2026-10-16 https://github.com/SV-Zanshin Fixed find() of patterns longer than the SRAM_COPY_BYTES       **
+**                                                 window, that code is left out for windows of 255 bytes or more **
+** 1.0.31 2026-10-16 https://github.com/SV-Zanshin fillMemory() with a count of 0 writes nothing, filling to the  **
+**                                                 end of memory is a separate overload without a count           **
+** 1.0.30 2026-10-16 https://github.com/SV-Zanshin setMode() only accepts sequential mode, page mode is internal  **
+**                                                 to getPage() and putPage(); dummy byte test is removed at      **
+**                                                 compile time for SPI-only transports                           **
+** 1.0.29 2026-10-16 https://github.com/SV-Zanshin Constructor sends RSTIO on all lines first, a chip left in SDI **
+**                                                 or SQI mode after a reset is found again                       **
+** 1.0.28 2026-10-16 https://github.com/SV-Zanshin Added getField() and putField() to access one member of a      **
+**                                                 structure in the memory                                        **
+** 1.0.27 2026-10-16 https://github.com/SV-Zanshin Added count based get() and put() overloads for arrays         **
+** 1.0.26 2026-10-16 https://github.com/SV-Zanshin Added setMode() and getMode() with a cached mode and the page  **
+**                                                 mode getPage() and putPage()                                   **
+** 1.0.25 2026-10-16 https://github.com/SV-Zanshin Added SRAMLazyClear, which defers clearing pages until they    **
+**                                                 are written                                                    **
+** 1.0.24 2026-10-16 https://github.com/SV-Zanshin Added the SRAMWriteCombiner buffer that merges put() calls to  **
+**                                                 consecutive addresses                                          **
+** 1.0.23 2026-10-16 https://github.com/SV-Zanshin Added the SRAMReadAhead prefetch window for sequential get()   **
+**                                                 calls                                                          **
+** 1.0.22 2026-10-16 https://github.com/SV-Zanshin Added the SRAMCache write-back page cache with LRU replacement **
+**                                                 and flush()                                                    **
+** 1.0.21 2026-10-16 https://github.com/SV-Zanshin Added SRAMReader and SRAMWriter cursors that keep one          **
+**                                                 transaction open for streaming                                 **
+** 1.0.20 2026-10-16 https://github.com/SV-Zanshin Added getv() and putv() to transfer a list of buffers in as    **
+**                                                 few transactions as possible                                   **
+** 1.0.19 2026-10-16 https://github.com/SV-Zanshin Added find() searching the memory for a byte or a pattern in   **
+**                                                 one sequential read                                            **
+** 1.0.18 2026-10-16 https://github.com/SV-Zanshin Added checksum() computing a CRC-16/CCITT or CRC-32 of a       **
+**                                                 memory region                                                  **
+** 1.0.17 2026-10-16 https://github.com/SV-Zanshin Added compare() and compareRegions() returning the offset of   **
+**                                                 the first difference                                           **
+** 1.0.16 2026-10-16 https://github.com/SV-Zanshin Added copyTo() to copy a region to another memory instance     **
+** 1.0.15 2026-10-16 https://github.com/SV-Zanshin Added copy() and move() to copy regions within the memory      **
+**                                                 through a SRAM_COPY_BYTES buffer                               **
+** 1.0.14 2026-10-16 https://github.com/SV-Zanshin Added ranged clearMemory(start,length,value), clearing now     **
+**                                                 sends blocks                                                   **
+** 1.0.13 2026-10-16 https://github.com/SV-Zanshin fillMemory() writes all copies in one transaction, added       **
+**                                                 optional count and fixed return type                           **
+** 1.0.12 2026-10-16 https://github.com/SV-Zanshin Added setBusMode() and getBusMode() for SDI and SQI access on  **
+**                                                 the 23x512 and 23x1024                                         **
+** 1.0.11 2026-10-16 https://github.com/SV-Zanshin Added getAsync() and putAsync() returning an AsyncTransfer     **
+**                                                 handle, using DMA on RP2040                                    **
+** 1.0.10 2026-10-16 https://github.com/SV-Zanshin Moved all bus access into the transport template parameter,    **
+**                                                 default SRAMHardwareSPI, added MicrochipSRAMBase               **
+** 1.0.9  2026-10-16 https://github.com/SV-Zanshin Added host emulator in extras/host. Fixed detection of chips   **
+**                                                 with 2 address bytes and the sequential mode register value,   **
+**                                                 both found using it                                            **
+** 1.0.8  2026-10-16 https://github.com/SV-Zanshin Addresses are wrapped using a mask computed once the memory    **
+**                                                 size is known instead of a 32-bit modulo                       **
+** 1.0.7  2026-10-16 https://github.com/SV-Zanshin Added class template MicrochipSRAMChip and typedefs for each   **
+**                                                 chip, with address width and size known when compiling         **
+** 1.0.6  2026-10-16 https://github.com/SV-Zanshin Fast CS/SS toggling on AVR using the cached port register and  **
+**                                                 bit mask instead of digitalWrite()                             **
+** 1.0.5  2026-10-16 https://github.com/SV-Zanshin Constructor accepts SPI clock speed, bit order and mode. All   **
+**                                                 accesses now use SPI transactions with those settings          **
+** 1.0.4  2026-10-16 https://github.com/SV-Zanshin Templates get() and put() use block SPI transfers rather than  **
+**                                                 one SPI.transfer() call per byte                               **
 ** 1.0.3  2017-07-31 https://github.com/SV-Zanshin Only function prototypes may contain default values / optional **
 **                                                 parameter declarations, functions may not as this can cause    **
 **                                                 compiler errors                                                **
@@ -53,6 +113,7 @@
 *******************************************************************************************************************/
 #include "Arduino.h"                                                          // Arduino data type definitions    //
 #include <SPI.h>                                                              // SPI (Serial Peripheral Interface)//
+#include <stddef.h>                                                           // offsetof() used by SRAM_FIELD    //
 #ifndef MicrochipSRAM_h                                                       // Guard code definition            //
   #define MicrochipSRAM_h                                                     // Define the name inside guard code//
     /***************************************************************************************************************
@@ -62,7 +123,7 @@
     const uint8_t  SRAM_READ_MODE_REG  =      0x05;                           // Read the mode register           //
     const uint8_t  SRAM_BYTE_MODE      = B00000000;                           // 2MSB 00 is Byte mode             //
     const uint8_t  SRAM_PAGE_MODE      = B10000000;                           // 2MSB 10 is page mode             //
-    const uint8_t  SRAM_SEQ_MODE       = B11000000;                           // 2MSB 11 is sequential mode       //
+    const uint8_t  SRAM_SEQ_MODE       = B01000000;                           // 2MSB 01 is sequential mode       //
     const uint32_t SRAM_1024           =    131072;                           // Equates to 1mbit of storage      //
     const uint32_t SRAM_512            =     65536;                           // Equates to 512kbit of storage    //
     const uint32_t SRAM_256            =     32768;                           // Equates to 256kbit of storage    //
@@ -70,46 +131,1361 @@
     const uint32_t SRAM_64             =      8192;                           // Equates to 64kbit of storage     //
     const uint8_t  SRAM_WRITE_CODE     =         2;                           // Write                            //
     const uint8_t  SRAM_READ_CODE      =         3;                           // Read                             //
-  class MicrochipSRAM {                                                       // Class definition                 //
+    const uint8_t  SRAM_EDIO_CODE      =      0x3B;                           // Enter dual I/O (SDI) access      //
+    const uint8_t  SRAM_EQIO_CODE      =      0x38;                           // Enter quad I/O (SQI) access      //
+    const uint8_t  SRAM_RSTIO_CODE     =      0xFF;                           // Reset dual & quad I/O access     //
+    const uint8_t  SRAM_SPI_BUS        =         1;                           // Bus modes given as the number of //
+    const uint8_t  SRAM_SDI_BUS        =         2;                           // data lines used, SPI, dual I/O   //
+    const uint8_t  SRAM_SQI_BUS        =         4;                           // and quad I/O                     //
+    const uint8_t  SRAM_CRC16_CCITT    =        16;                           // CRC-16/CCITT checksum algorithm  //
+    const uint8_t  SRAM_CRC32          =        32;                           // CRC-32 checksum algorithm        //
+    const uint8_t  SRAM_BLOCK_SIZE     =        32;                           // Bytes per block transfer buffer  //
+    const uint8_t  SRAM_PAGE_BYTES     =        32;                           // Bytes per page on all the chips  //
+    const uint32_t SRAM_SPI_CLOCK      =  20000000;                           // Maximum rated SPI clock of 20MHz //
+    /***************************************************************************************************************
+    ** On AVR processors digitalWrite() takes several microseconds, which is longer than the whole data transfer  **
+    ** for small types, so the CS/SS pin's output port register and bit mask are cached and written directly. All **
+    ** other platforms use the portable digitalWrite() call.                                                      **
+    ***************************************************************************************************************/
+    #if defined(__AVR__)                                                      // Direct port access for AVR only  //
+      #define SRAM_FAST_CS                                                    // Use cached port register & mask  //
+    #endif                                                                    // of if-then AVR processor         //
+    /***************************************************************************************************************
+    ** The RP2040 core's SPI library can move a block using DMA while the processor carries on, so the            **
+    ** asynchronous transfers use it there. All other platforms, including AVR and the host emulator, complete    **
+    ** the asynchronous transfers before returning. (v1.0.11)                                                     **
+    ***************************************************************************************************************/
+    #if defined(ARDUINO_ARCH_RP2040) && !defined(ARDUINO_ARCH_MBED)           // arduino-pico core has DMA SPI    //
+      #define SRAM_SPI_DMA                                                    // Use transferAsync() for blocks   //
+    #endif                                                                    // of if-then RP2040 processor      //
+    /***************************************************************************************************************
+    ** Copying and moving data within the memory goes through a buffer on the stack of SRAM_COPY_BYTES bytes. The **
+    ** larger the buffer the fewer commands are needed, so it is kept small on the AVR processors with only 2KB   **
+    ** of RAM and larger elsewhere. It can be changed by defining SRAM_COPY_BYTES before including this file.     **
+    ** (v1.0.15)                                                                                                  **
+    ***************************************************************************************************************/
+    #ifndef SRAM_COPY_BYTES                                                   // Unless set by the sketch use     //
+      #if defined(__AVR__)                                                    // a small buffer on AVR and        //
+        #define SRAM_COPY_BYTES 64                                            //                                  //
+      #else                                                                   // a larger one on other processors //
+        #define SRAM_COPY_BYTES 512                                           //                                  //
+      #endif                                                                  // of if-then AVR processor         //
+    #endif                                                                    // of if-then not set by sketch     //
+  /*****************************************************************************************************************
+  ** A segment is one buffer in MCU memory used by the vectored getv() and putv() methods, which transfer a list  **
+  ** of segments to or from the memory. "addr" is only used by the versions of getv() and putv() without a start  **
+  ** address, where each segment has its own memory address. (v1.0.20) getv() fills the buffers of SRAMSegment    **
+  ** lists and putv() only reads the buffers of SRAMConstSegment lists, so constant data can be written without a **
+  ** cast (v1.0.33).                                                                                              **
+  *****************************************************************************************************************/
+  struct SRAMSegment {                                                        // One buffer filled by getv()      //
+    void     *buffer;                                                         // Buffer in MCU memory             //
+    uint32_t  bytes;                                                          // Number of bytes in the buffer    //
+    uint32_t  addr;                                                           // Memory address if not adjacent   //
+  }; // of struct SRAMSegment                                                 //                                  //
+  struct SRAMConstSegment {                                                   // One buffer written by putv()     //
+    const void *buffer;                                                       // Buffer in MCU memory             //
+    uint32_t    bytes;                                                        // Number of bytes in the buffer    //
+    uint32_t    addr;                                                         // Memory address if not adjacent   //
+  }; // of struct SRAMConstSegment                                            //                                  //
+  /*****************************************************************************************************************
+  ** SRAM_FIELD(structure,member) describes a member of a structure for getField() and putField(). The SRAMField  **
+  ** holds the member's offset, which is a constant computed using offsetof(), and its type as the template       **
+  ** parameter, so the value passed to putField() is converted to the member's type. (v1.0.28)                    **
+  *****************************************************************************************************************/
+  template<typename F> struct SRAMField {                                     // Offset and type of a member      //
+    typedef F Type;                                                           // Type of the member               //
+    size_t    offset;                                                         // Offset within the structure      //
+  }; // of struct SRAMField                                                   //                                  //
+  #define SRAM_FIELD(s,m) (SRAMField<decltype(s::m)>{offsetof(s,m)})          // Describe member "m" of "s"       //
+  template<class Memory> class SRAMCursor;                                    // Base of SRAMReader and SRAMWriter//
+  uint16_t SRAMUpdateCRC16(uint16_t crc,const uint8_t *data,                  // CRC kernels used by checksum(),  //
+                           const uint16_t bytes);                             // see MicrochipSRAM.cpp            //
+  uint32_t SRAMUpdateCRC32(uint32_t crc,const uint8_t *data,                  //                                  //
+                           const uint16_t bytes);                             //                                  //
+  /*****************************************************************************************************************
+  ** All access to the memory goes through a transport class, which is a template parameter of MicrochipSRAMBase  **
+  ** so that a different SPI peripheral, a bit-banged bus, a DMA engine or the host emulator can be used in its   **
+  ** place without any virtual call overhead. A transport class has the following methods (v1.0.10):              **
+  ** begin()                  - set up the bus and CS/SS pin, called once by the constructor                      **
+  ** select() / deselect()    - start or end a command by claiming the bus and pulling CS/SS low or high          **
+  ** transfer(byte)           - send one byte and return the byte read at the same time                           **
+  ** read(buffer,bytes)       - read a block of bytes into a buffer                                               **
+  ** write(buffer,bytes)      - write a block of bytes from a buffer                                              **
+  ** readAsync(buffer,bytes)  - start reading a block of bytes, which may complete in the background              **
+  ** writeAsync(buffer,bytes) - start writing a block of bytes, which may complete in the background              **
+  ** busy()                   - returns true while an asynchronous transfer is still in progress                  **
+  ** setBusWidth(lines)       - use 1, 2 or 4 data lines from now on, at most MAX_BUS_WIDTH which is a constant   **
+  ** In dual and quad I/O mode the data lines only go in one direction at a time, so transfer() then only sends   **
+  ** and all data is read using read() or readAsync().                                                            **
+  ** SRAMHardwareSPI is the default transport and uses the Arduino SPI library and a CS/SS pin.                   **
+  *****************************************************************************************************************/
+  class SRAMHardwareSPI {                                                     // Transport using the SPI library  //
     public:                                                                   // Publicly visible methods         //
-      MicrochipSRAM(const uint8_t SSPin);                                     // Class constructor                //
-      ~MicrochipSRAM();                                                       // Class destructor                 //
+      SRAMHardwareSPI(const uint8_t SSPin,                                    // Class constructor                //
+                      const uint32_t clockSpeed = SRAM_SPI_CLOCK,             // Optional SPI clock speed in Hz,  //
+                      const uint8_t  bitOrder   = MSBFIRST,                   // bit order and                    //
+                      const uint8_t  dataMode   = SPI_MODE0);                 // SPI mode                         //
+      void     begin();                                                       // Set up the CS/SS pin and SPI     //
+      void     select() {                                                     // Start transaction, pull CS low   //
+        SPI.beginTransaction(_SPISettings);                                   // Use this memory's SPI settings   //
+        #ifdef SRAM_FAST_CS                                                   // Write port register directly,    //
+          uint8_t oldSREG = SREG;                                             // with interrupts disabled since   //
+          cli();                                                              // the read-modify-write of the     //
+          *_SSPort &= ~_SSMask;                                               // port must be atomic              //
+          SREG = oldSREG;                                                     // Restore the interrupt state      //
+        #else                                                                 // otherwise use the portable       //
+          digitalWrite(_SSPin,LOW);                                           // but slower digitalWrite()        //
+        #endif                                                                // of if-then fast CS available     //
+      } // of method select                                                   //----------------------------------//
+      void     deselect() {                                                   // Pull CS high, end transaction    //
+        #ifdef SRAM_FAST_CS                                                   // Write port register directly,    //
+          uint8_t oldSREG = SREG;                                             // with interrupts disabled since   //
+          cli();                                                              // the read-modify-write of the     //
+          *_SSPort |= _SSMask;                                                // port must be atomic              //
+          SREG = oldSREG;                                                     // Restore the interrupt state      //
+        #else                                                                 // otherwise use the portable       //
+          digitalWrite(_SSPin,HIGH);                                          // but slower digitalWrite()        //
+        #endif                                                                // of if-then fast CS available     //
+        SPI.endTransaction();                                                 // Release the SPI bus again        //
+      } // of method deselect                                                 //----------------------------------//
+      uint8_t  transfer(const uint8_t data) { return SPI.transfer(data); }    // Send and receive one byte        //
+      void     read(void *buffer,uint32_t bytes);                             // Read a block into a buffer       //
+      void     write(const void *buffer,uint32_t bytes);                      // Write a block from a buffer      //
+      void     readAsync(void *buffer,uint32_t bytes);                        // Start reading a block            //
+      void     writeAsync(const void *buffer,uint32_t bytes);                 // Start writing a block            //
+      static const uint8_t MAX_BUS_WIDTH = 1;                                 // The SPI library has 1 data line  //
+      void     setBusWidth(const uint8_t lines) { (void)lines; }              // in each direction only           //
+      bool     busy() {                                                       // True while a DMA transfer runs   //
+        #ifdef SRAM_SPI_DMA                                                   // Ask the SPI library whether the  //
+          return !SPI.finishedAsync();                                        // DMA transfer has completed       //
+        #else                                                                 // otherwise transfers are always   //
+          return false;                                                       // blocking and never busy          //
+        #endif                                                                // of if-then DMA available         //
+      } // of method busy                                                     //----------------------------------//
+    private:                                                                  // Private variables and methods    //
+      SPISettings _SPISettings;                                               // Settings for each transaction    //
+      uint8_t  _SSPin    = 0;                                                 // The CS/SS pin attached           //
+      #ifdef SRAM_FAST_CS                                                     // Only with direct port access     //
+        volatile uint8_t *_SSPort = NULL;                                     // Output port register of CS/SS    //
+        uint8_t  _SSMask = 0;                                                 // Bit mask of CS/SS in the port    //
+      #endif                                                                  // of if-then fast CS available     //
+  }; // of SRAMHardwareSPI class definition                                   //                                  //
+  /*****************************************************************************************************************
+  ** The MicrochipSRAMBase class template contains all of the methods used to access the memory through the       **
+  ** transport class given in "Transport". If the memory chip is known when compiling, its size is given in       **
+  ** "CHIP_BYTES" and the number of address bytes and the mask used to wrap addresses are then constants, so no   **
+  ** method needs to test the chip type or use a variable mask. If "CHIP_BYTES" is 0 the memory size is detected  **
+  ** by the constructor. (v1.0.10)                                                                                **
+  *****************************************************************************************************************/
+  template<class Transport = SRAMHardwareSPI, uint32_t CHIP_BYTES = 0>        // Memory using the given transport //
+  class MicrochipSRAMBase {                                                   // and optional fixed memory size   //
+    public:                                                                   // Publicly visible methods         //
+      MicrochipSRAMBase(const Transport &transport);                          // Class constructor                //
       void clearMemory(const uint8_t clearValue = 0);                         // Clear all memory to one value    //
+      void clearMemory(const uint32_t start,const uint32_t length,            // Clear "length" bytes from        //
+                       const uint8_t clearValue = 0);                         // "start" to one value             //
       /*************************************************************************************************************
       ** Declare the get and put methods as template functions here in the header file. This allows any type of   **
       ** variable or structure to be used rather than having to make one function for each datatype used. Note    **
       ** that due to the sequential mode being active, reads and writes that go past the last existing address    **
       ** will automatically wrap back to the beginning of the memory                                              **
       *************************************************************************************************************/
-      template< typename T > uint32_t &get(const uint32_t addr,T &value) {    // method to write a structure      //
-        uint8_t* bytePtr       = (uint8_t*)&value;                            // Pointer to structure beginning   //
-        uint32_t returnAddress = (addr+sizeof(T))%SRAMBytes;                  // compute the return address       //
-        digitalWrite(_SSPin,LOW);                                             // Pull CS/SS low to select device  //
-        SPI.transfer(SRAM_READ_CODE);                                         // Send the command for WRITE mode  //
-        if (SRAMBytes==SRAM_1024) SPI.transfer((uint8_t)(addr>>16)&0xFF);     // Send the MSB of the 24bit address//
-        SPI.transfer((uint8_t)(addr>>8) & 0xFF);                              // Send the 2nd byte of the address //
-        SPI.transfer((uint8_t)addr);                                          // Send the LSB of the address      //
-        for (uint32_t i=0;i<sizeof(T);i++) *bytePtr++ = SPI.transfer(0x00);   // loop for each byte to be read    //
-        digitalWrite(_SSPin,HIGH);                                            // Pull the SS/CS high to deselect  //
-        return(returnAddress);                                                // Return the computed new address  //
+      template< typename T > uint32_t get(const uint32_t addr,T &value) {     // method to read a structure       //
+        beginCommand(SRAM_READ_CODE,addr);                                    // Select chip, send READ & address //
+        _Transport.read(&value,sizeof(T));                                    // Read whole structure in blocks   //
+        _Transport.deselect();                                                // Pull the SS/CS high to deselect  //
+        return((addr+sizeof(T))&addressMask());                               // Return the computed new address  //
+      } // of method get                                                      //----------------------------------//
+      template<typename T> uint32_t put(const uint32_t addr,const T &value) { // method to write a structure      //
+        beginCommand(SRAM_WRITE_CODE,addr);                                   // Select chip, send WRITE & addr   //
+        _Transport.write(&value,sizeof(T));                                   // Write whole structure in blocks  //
+        _Transport.deselect();                                                // Pull the SS/CS high to deselect  //
+        return((addr+sizeof(T))&addressMask());                               // Return the computed new address  //
+      } // of method put                                                      //----------------------------------//
+      /*************************************************************************************************************
+      ** The getField and putField methods read or write one member of a structure stored in the memory at        **
+      ** "base", so that only the bytes of that member are transferred, in one transaction. The member is given   **
+      ** by SRAM_FIELD(structure,member), which holds its offset, computed when compiling using offsetof(), and   **
+      ** its type, so a value of another type is converted to the member's type first, e.g.                       **
+      ** "memory.putField(base,SRAM_FIELD(Record,count),5);" writes 2 bytes if "count" is a uint16_t. A plain     **
+      ** offset can be given instead, when the number of bytes transferred is the size of "value". Pointers to    **
+      ** members aren't used as their offset can't be found when compiling. The address following the member is   **
+      ** returned. (v1.0.28)                                                                                      **
+      *************************************************************************************************************/
+      template<typename F> uint32_t getField(const uint32_t base,             // Read one member of a structure   //
+                                             const SRAMField<F> field,        //                                  //
+                                             F &value) {                      //                                  //
+        return get(base+field.offset,value);                                  //                                  //
+      } // of method getField                                                 //----------------------------------//
+      template<typename F> uint32_t putField(const uint32_t base,             // Write one member of a structure, //
+        const SRAMField<F> field,                                             // converting the value to the      //
+        const typename SRAMField<F>::Type &value) {                           // member's type                    //
+        return put(base+field.offset,value);                                  //                                  //
+      } // of method putField                                                 //----------------------------------//
+      template<typename F> uint32_t getField(const uint32_t base,             // Read a member at an offset       //
+                                             const size_t offset,F &value) {  // within a structure               //
+        return get(base+offset,value);                                        //                                  //
+      } // of method getField                                                 //----------------------------------//
+      template<typename F> uint32_t putField(const uint32_t base,             // Write a member at an offset      //
+                                             const size_t offset,             // within a structure               //
+                                             const F &value) {                //                                  //
+        return put(base+offset,value);                                        //                                  //
+      } // of method putField                                                 //----------------------------------//
+      /*************************************************************************************************************
+      ** The count based get and put methods read or write "count" elements of an array, e.g. 500 int16_t         **
+      ** samples, in one transaction. The count is a size_t, which is 16 bits on the AVR processors and so        **
+      ** matches the size of any array in their RAM without needing 32 bit arithmetic for it. Arrays of a fixed   **
+      ** size, including std::array where available, are a single variable and are moved in one transaction by    **
+      ** the get and put methods above, e.g. "int16_t samples[500]; memory.get(0,samples);". (v1.0.27)            **
+      *************************************************************************************************************/
+      template<typename T> uint32_t get(const uint32_t addr,T *items,         // Read "count" elements of an      //
+                                        const size_t count) {                 // array                            //
+        if (count==0) return addr&addressMask();                              // Nothing to read                  //
+        beginCommand(SRAM_READ_CODE,addr);                                    // Select chip, send READ & address //
+        _Transport.read(items,(uint32_t)count*sizeof(T));                     // Read all elements in blocks      //
+        _Transport.deselect();                                                // Pull the SS/CS high to deselect  //
+        return (addr+(uint32_t)count*sizeof(T))&addressMask();                // Return the computed new address  //
       } // of method get                                                      //----------------------------------//
-      template<typename T> uint32_t &put(const uint32_t addr,const T &value){ // method to get a structure        //
-        const uint8_t* bytePtr = (const uint8_t*)&value;                      // Pointer to structure beginning   //
-        uint32_t returnAddress = (addr+sizeof(T))%SRAMBytes;                  // compute the return address       //
-        digitalWrite(_SSPin,LOW);                                             // Pull CS/SS low to select device  //
-        SPI.transfer(SRAM_WRITE_CODE);                                        // Send the command for WRITE mode  //
-        if (SRAMBytes==SRAM_1024) SPI.transfer((uint8_t)(addr>>16)&0xFF);     // Send the MSB of the 24bit address//
-        SPI.transfer((uint8_t)(addr>>8) & 0xFF);                              // Send the 2nd byte of the address //
-        SPI.transfer((uint8_t)addr);                                          // Send the LSB of the address      //
-        for (uint32_t i=0;i<sizeof(T);i++) SPI.transfer(*bytePtr++);          // loop for each byte to be written //
-        digitalWrite(_SSPin,HIGH);                                            // Pull the SS/CS high to deselect  //
-        return(returnAddress);                                                // Return the computed new address  //
+      template<typename T> uint32_t put(const uint32_t addr,const T *items,   // Write "count" elements of an     //
+                                        const size_t count) {                 // array                            //
+        if (count==0) return addr&addressMask();                              // Nothing to write                 //
+        beginCommand(SRAM_WRITE_CODE,addr);                                   // Select chip, send WRITE & addr   //
+        _Transport.write(items,(uint32_t)count*sizeof(T));                    // Write all elements in blocks     //
+        _Transport.deselect();                                                // Pull the SS/CS high to deselect  //
+        return (addr+(uint32_t)count*sizeof(T))&addressMask();                // Return the computed new address  //
       } // of method put                                                      //----------------------------------//
-      template< typename T > &fillMemory( uint32_t addr, T &value ) {         // method to fill memory with values//
-        while(addr<(SRAMBytes-sizeof(T))) addr = put(addr,value);             // loop until we reach end of memory//
+      /*************************************************************************************************************
+      ** The getAsync and putAsync methods start reading or writing a variable or structure and return an         **
+      ** AsyncTransfer handle at once. The transfer then continues in the background if the transport supports    **
+      ** it, and the handle's done() method returns true and wait() returns once it has finished. The memory is   **
+      ** deselected and the SPI bus released when the completion is seen, so the variable mustn't be used or      **
+      ** changed until then. Any other access to the memory first waits for the transfer to finish. (v1.0.11)     **
+      *************************************************************************************************************/
+      class AsyncTransfer {                                                   // Handle of an async transfer      //
+        public:                                                               // Publicly visible methods         //
+          AsyncTransfer(MicrochipSRAMBase *memory,const uint32_t next)        // Class constructor                //
+            : nextAddress(next), _Memory(memory) {}                           //                                  //
+          bool     done() { return _Memory->asyncDone(); }                    // True once transfer has finished  //
+          void     wait() { while (!done()) {} }                              // Wait until transfer has finished //
+          uint32_t nextAddress;                                               // Address following the transfer   //
+        private:                                                              // Private variables and methods    //
+          MicrochipSRAMBase *_Memory;                                         // Memory doing the transfer        //
+      }; // of AsyncTransfer class definition                                 //                                  //
+      template<typename T> AsyncTransfer getAsync(const uint32_t addr,        // Start reading a structure        //
+                                                  T &value) {                 //                                  //
+        beginCommand(SRAM_READ_CODE,addr);                                    // Select chip, send READ & address //
+        _Transport.readAsync(&value,sizeof(T));                               // Start reading the structure      //
+        _AsyncPending = true;                                                 // Deselect once it has finished    //
+        return AsyncTransfer(this,(addr+sizeof(T))&addressMask());            // Return handle and next address   //
+      } // of method getAsync                                                 //----------------------------------//
+      template<typename T> AsyncTransfer putAsync(const uint32_t addr,        // Start writing a structure        //
+                                                  const T &value) {           //                                  //
+        beginCommand(SRAM_WRITE_CODE,addr);                                   // Select chip, send WRITE & addr   //
+        _Transport.writeAsync(&value,sizeof(T));                              // Start writing the structure      //
+        _AsyncPending = true;                                                 // Deselect once it has finished    //
+        return AsyncTransfer(this,(addr+sizeof(T))&addressMask());            // Return handle and next address   //
+      } // of method putAsync                                                 //----------------------------------//
+      uint32_t getv(const uint32_t addr,const SRAMSegment *segments,          // Read adjacent memory into a list //
+                    const uint8_t count);                                     // of buffers in one transaction    //
+      uint32_t putv(const uint32_t addr,const SRAMConstSegment *segments,     // Write a list of buffers to       //
+                    const uint8_t count);                                     // adjacent memory in one transfer  //
+      uint32_t getv(const SRAMSegment *segments,const uint8_t count);         // Read and write buffers at their  //
+      uint32_t putv(const SRAMConstSegment *segments,const uint8_t count);    // own addresses, merging adjacent  //
+      uint32_t copy(const uint32_t dst,const uint32_t src,                    // Copy a non-overlapping region    //
+                    const uint32_t length);                                   // within the memory                //
+      uint32_t move(const uint32_t dst,const uint32_t src,                    // Copy a region within the memory, //
+                    const uint32_t length);                                   // which may overlap                //
+      template<class Memory> uint32_t copyTo(Memory &other,                   // Copy a region to another memory  //
+                                             const uint32_t srcAddr,          //                                  //
+                                             const uint32_t dstAddr,          //                                  //
+                                             const uint32_t length);          //                                  //
+      uint32_t compare(const uint32_t addr,const void *buffer,                // Offset of the first difference   //
+                       const uint32_t length);                                // to a buffer, length if none      //
+      uint32_t compareRegions(const uint32_t addrA,const uint32_t addrB,      // Offset of the first difference   //
+                              const uint32_t length);                         // of two regions, length if none   //
+      uint32_t find(const uint32_t addr,const uint32_t length,                // Offset of the first byte with a  //
+                    const uint8_t value);                                     // value, length if none            //
+      uint32_t find(const uint32_t addr,const uint32_t length,                // Offset of the first copy of a    //
+                    const void *pattern,const uint8_t patternLength);         // pattern, length if none          //
+      uint32_t checksum(const uint32_t addr,const uint32_t length,            // CRC-16/CCITT or CRC-32 of a      //
+                        const uint8_t algorithm = SRAM_CRC32);                // region of the memory             //
+      bool setBusMode(const uint8_t lines);                                   // Switch to SPI, SDI or SQI access //
+      uint8_t getBusMode() const { return _BusWidth; }                        // Data lines currently in use      //
+      bool setMode(const uint8_t mode);                                       // Back to sequential mode          //
+      uint8_t getMode(const bool readChip = false);                           // Mode in use, optionally read     //
+      /*************************************************************************************************************
+      ** The getPage and putPage methods read or write a variable or structure in page mode, where the address    **
+      ** wraps around within the 32 byte page instead of going on to the next page, e.g. for ring buffers of up   **
+      ** to SRAM_PAGE_BYTES bytes. The memory is switched to page mode if needed and the other methods switch it  **
+      ** back to sequential mode, so page accesses should be grouped together. Page mode is only used by these    **
+      ** two methods. The address following the last byte is returned, which is also within the page. (v1.0.26)   **
+      *************************************************************************************************************/
+      template<typename T> uint32_t getPage(const uint32_t addr,T &value) {   // Read a structure in page mode    //
+        beginCommand(SRAM_READ_CODE,addr,SRAM_PAGE_MODE);                     // Select chip, send READ & address //
+        _Transport.read(&value,sizeof(T));                                    // Read whole structure in blocks   //
+        _Transport.deselect();                                                // Pull the SS/CS high to deselect  //
+        return pageAddress(addr,sizeof(T));                                   // Next address within the page     //
+      } // of method getPage                                                  //----------------------------------//
+      template<typename T> uint32_t putPage(const uint32_t addr,              // Write a structure in page mode   //
+                                            const T &value) {                 //                                  //
+        beginCommand(SRAM_WRITE_CODE,addr,SRAM_PAGE_MODE);                    // Select chip, send WRITE & addr   //
+        _Transport.write(&value,sizeof(T));                                   // Write whole structure in blocks  //
+        _Transport.deselect();                                                // Pull the SS/CS high to deselect  //
+        return pageAddress(addr,sizeof(T));                                   // Next address within the page     //
+      } // of method putPage                                                  //----------------------------------//
+      /*************************************************************************************************************
+      ** Method fillMemory writes "count" copies of a variable or structure starting at "addr" and returns the    **
+      ** address following the last copy. A "count" of 0 writes nothing. Without a "count" the memory is filled   **
+      ** up to its end with as many whole copies as fit (v1.0.31, before this a "count" of 0 did that). All       **
+      ** copies are sent in a single sequential write, with CS/SS held low, from a buffer holding as many copies  **
+      ** as fit in SRAM_BLOCK_SIZE bytes, so the command and address are only sent once. Before v1.0.13 each copy **
+      ** was written by its own put() call and the last copy which would fit wasn't written.                      **
+      *************************************************************************************************************/
+      template<typename T> uint32_t fillMemory(const uint32_t addr,           // method to fill memory with values//
+                                               const T &value,                //                                  //
+                                               const uint32_t count) {        //                                  //
+        const uint32_t start = addr&addressMask();                            // Wrap the start address           //
+        if (count==0) return start;                                           // Nothing to write                 //
+        beginCommand(SRAM_WRITE_CODE,start);                                  // Select chip, send WRITE & addr   //
+        if (sizeof(T)<=SRAM_BLOCK_SIZE) {                                     // Small types are repeated in a    //
+          const uint8_t perBlock = SRAM_BLOCK_SIZE/sizeof(T);                 // block buffer and whole blocks    //
+          uint8_t pattern[SRAM_BLOCK_SIZE];                                   // are sent at a time               //
+          for (uint8_t i=0;i<perBlock;i++)                                    //                                  //
+            memcpy(&pattern[i*sizeof(T)],&value,sizeof(T));                   //                                  //
+          for (uint32_t left=count;left>0;) {                                 // Loop until all copies are sent   //
+            const uint8_t copies = (left>perBlock) ? perBlock : left;         // Send at most one block at once   //
+            _Transport.write(pattern,copies*sizeof(T));                       //                                  //
+            left -= copies;                                                   //                                  //
+          } // of for-next each block                                         //                                  //
+        } else {                                                              // Large types are sent directly    //
+          for (uint32_t i=0;i<count;i++) _Transport.write(&value,sizeof(T));  // one copy at a time               //
+        } // of if-then-else type fits in a block                             //                                  //
+        _Transport.deselect();                                                // Pull the SS/CS high to deselect  //
+        return (start+count*sizeof(T))&addressMask();                         // Return the computed new address  //
+      } // of method fillMemory                                               //----------------------------------//
+      template<typename T> uint32_t fillMemory(const uint32_t addr,           // Fill from "addr" up to the end   //
+                                               const T &value) {              // of the memory                    //
+        const uint32_t start = addr&addressMask();                            // Wrap the start address           //
+        return fillMemory(start,value,start<SRAMBytes ?                       // As many whole copies as fit      //
+                          (SRAMBytes-start)/sizeof(T) : 0);                   //                                  //
       } // of method fillMemory                                               //----------------------------------//
       uint32_t SRAMBytes = 0;                                                 // Number of bytes available on chip//
-    private:                                                                  // Private variables and methods    //
-      uint8_t  _SSPin    = 0;                                                 // The CS/SS pin attached           //
+    protected:                                                                // Used by derived classes          //
+      uint32_t addressMask() const {                                          // Mask to wrap addresses, which    //
+        return CHIP_BYTES ? CHIP_BYTES-1 : _AddressMask;                      // is a constant for a known chip   //
+      } // of method addressMask                                              //----------------------------------//
+      bool     wideAddress() const {                                          // True if 3 address bytes used,    //
+        return (CHIP_BYTES ? CHIP_BYTES : SRAMBytes)>SRAM_512;                // a constant for a known chip      //
+      } // of method wideAddress                                              //----------------------------------//
+      void     beginCommand(const uint8_t command,const uint32_t addr,        // Select chip, send command & addr //
+                            const uint8_t mode = SRAM_SEQ_MODE);              // using the given mode             //
+      void     writeMode(const uint8_t mode);                                 // Write mode register if changed   //
+      uint32_t pageAddress(const uint32_t addr,const uint32_t bytes) const {  // Address "bytes" after "addr",    //
+        return (addr&addressMask()&~(SRAM_PAGE_BYTES-1UL))|                   // wrapping within its page         //
+               ((addr+bytes)&(SRAM_PAGE_BYTES-1));                            //                                  //
+      } // of method pageAddress                                              //----------------------------------//
+      void     detectMemory();                                                // Find the size of the memory      //
+      template<class Memory> uint32_t copyForward(Memory &target,             // Copy chunks from the start of a  //
+        const uint32_t dst,const uint32_t src,const uint32_t length);         // region to any memory             //
+      template<class Memory> void copyChunk(Memory &target,                   // Read one chunk into the buffer   //
+        const uint32_t dst,const uint32_t src,                                // and write it to the target       //
+        uint8_t *buffer,const uint16_t bytes);                                //                                  //
+      template<class, uint32_t> friend class MicrochipSRAMBase;               // Used by copyTo() other memories  //
+      template<class> friend class SRAMCursor;                                // Keeps a transaction open         //
+      template<class Segment>                                                 // Read or write a list of buffers  //
+      uint32_t transferSegments(const uint8_t command,uint32_t addr,          // using as few transactions as     //
+                                const Segment *segments,                      // possible                         //
+                                const uint8_t count,const bool ownAddress);   //                                  //
+      void     transferBuffer(const uint8_t command,void *buffer,             // Read or write a segment's buffer //
+                              const uint32_t bytes) {                         //                                  //
+        if (command==SRAM_READ_CODE) _Transport.read(buffer,bytes);           //                                  //
+                                else _Transport.write(buffer,bytes);          //                                  //
+      } // of method transferBuffer                                           //----------------------------------//
+      void     transferBuffer(const uint8_t command,const void *buffer,       // A constant buffer can only be    //
+                              const uint32_t bytes) {                         // written                          //
+        (void)command;                                                        //                                  //
+        _Transport.write(buffer,bytes);                                       //                                  //
+      } // of method transferBuffer                                           //----------------------------------//
+      static uint16_t firstDifference(const uint8_t *a,const uint8_t *b,      // Index of first differing byte,   //
+                                      const uint16_t bytes) {                 // "bytes" if they are identical    //
+        if (memcmp(a,b,bytes)==0) return bytes;                               // Use the fast library compare     //
+        uint16_t i = 0;                                                       // and only search for the byte     //
+        while (a[i]==b[i]) i++;                                               // if there is a difference         //
+        return i;                                                             //                                  //
+      } // of method firstDifference                                          //----------------------------------//
+      bool     asyncDone() {                                                  // Deselect the chip once a pending //
+        if (_AsyncPending && !_Transport.busy()) {                            // async transfer has finished and  //
+          _Transport.deselect();                                              // return true if none is pending   //
+          _AsyncPending = false;                                              //                                  //
+        } // of if-then pending transfer has finished                         //                                  //
+        return !_AsyncPending;                                                //                                  //
+      } // of method asyncDone                                                //----------------------------------//
+      Transport _Transport;                                                   // Transport used for all access    //
+      uint32_t _AddressMask = 0xFFFFFFFF;                                     // Wraps addresses, SRAMBytes-1     //
+      bool     _AsyncPending = false;                                         // Async transfer not yet finished  //
+      uint8_t  _BusWidth     = SRAM_SPI_BUS;                                  // Data lines in use, SPI at start  //
+      uint8_t  _Mode         = SRAM_SEQ_MODE;                                 // Mode register, set by constructor//
+  }; // of MicrochipSRAMBase class definition                                 //                                  //
+  /*****************************************************************************************************************
+  ** The MicrochipSRAM class is the memory using the SPI library and a CS/SS pin, whose size is detected when it  **
+  ** is instantiated. This is the class used by most sketches.                                                    **
+  *****************************************************************************************************************/
+  class MicrochipSRAM : public MicrochipSRAMBase<SRAMHardwareSPI> {           // Class definition                 //
+    public:                                                                   // Publicly visible methods         //
+      MicrochipSRAM(const uint8_t SSPin,                                      // Class constructor                //
+                    const uint32_t clockSpeed = SRAM_SPI_CLOCK,               // Optional SPI clock speed in Hz,  //
+                    const uint8_t  bitOrder   = MSBFIRST,                     // bit order and                    //
+                    const uint8_t  dataMode   = SPI_MODE0);                   // SPI mode                         //
+      ~MicrochipSRAM();                                                       // Class destructor                 //
   }; // of MicrochipSRAM class definition                                     //                                  //
+  /*****************************************************************************************************************
+  ** The MicrochipSRAMChip class template is used when the memory chip is known when compiling. The number of     **
+  ** address bytes, the memory size and the mask used to wrap addresses are then constants, so the get() and      **
+  ** put() methods don't need to test the chip type or use a variable mask to compute the next address. The       **
+  ** typedefs MicrochipSRAM23x640, MicrochipSRAM23x256, MicrochipSRAM23x512 and MicrochipSRAM23x1024 can be used  **
+  ** to declare a specific chip, e.g. "MicrochipSRAM23x1024 memory(SS);". All other methods are those of          **
+  ** MicrochipSRAMBase, and the MicrochipSRAM class should be used if the memory chip is not known as it detects  **
+  ** the chip type. (v1.0.7)                                                                                      **
+  *****************************************************************************************************************/
+  template<uint32_t CHIP_BYTES, class Transport = SRAMHardwareSPI>            // Class for a known memory chip    //
+  class MicrochipSRAMChip : public MicrochipSRAMBase<Transport,CHIP_BYTES> {  // using the given transport        //
+    public:                                                                   // Publicly visible methods         //
+      static constexpr uint32_t CHIP_SIZE     = CHIP_BYTES;                   // Number of bytes on the chip      //
+      static constexpr uint8_t  ADDRESS_BYTES = CHIP_BYTES>SRAM_512 ? 3 : 2;  // 1Mbit chips use 3 address bytes  //
+      static constexpr uint32_t ADDRESS_MASK  = CHIP_BYTES-1;                 // Sizes are all powers of two      //
+      MicrochipSRAMChip(const uint8_t SSPin,                                  // Class constructor                //
+                        const uint32_t clockSpeed = SRAM_SPI_CLOCK,           // Optional SPI clock speed in Hz,  //
+                        const uint8_t  bitOrder   = MSBFIRST,                 // bit order and                    //
+                        const uint8_t  dataMode   = SPI_MODE0)                // SPI mode                         //
+        : MicrochipSRAMBase<Transport,CHIP_BYTES>                             // Chip size needn't be detected    //
+          (Transport(SSPin,clockSpeed,bitOrder,dataMode)) {}                  //                                  //
+      MicrochipSRAMChip(const Transport &transport)                           // Constructor for other transports //
+        : MicrochipSRAMBase<Transport,CHIP_BYTES>(transport) {}               //                                  //
+  }; // of MicrochipSRAMChip class definition                                 //                                  //
+  typedef MicrochipSRAMChip<SRAM_64>   MicrochipSRAM23x640;                   // 23x640 64kbit memory             //
+  typedef MicrochipSRAMChip<SRAM_256>  MicrochipSRAM23x256;                   // 23x256 256kbit memory            //
+  typedef MicrochipSRAMChip<SRAM_512>  MicrochipSRAM23x512;                   // 23x512 & 23LCV512 512kbit memory //
+  typedef MicrochipSRAMChip<SRAM_1024> MicrochipSRAM23x1024;                  // 23x1024 & 23LCV1024 1Mbit memory //
+  /*****************************************************************************************************************
+  ** The SRAMReader and SRAMWriter class templates are cursors for streaming data, e.g. audio samples or a log    **
+  ** being replayed. The constructor selects the memory and sends the READ or WRITE command and address once, and **
+  ** each read() or write() after that only clocks the data bytes as the memory is in sequential mode. The        **
+  ** transaction is ended by end() or the destructor. Reading or writing after end() starts a new transaction at  **
+  ** the cursor's address, and begin() moves the cursor to a new address. The memory wraps back to address 0      **
+  ** after the last byte, and address() wraps in the same way at SRAMBytes.                                       **
+  ** As CS/SS stays low and the SPI bus is claimed while the cursor is open, no other access to the memory or to  **
+  ** other devices on the bus may be done until end() has been called. The template parameter is the memory       **
+  ** class, e.g. "SRAMReader<MicrochipSRAM23x1024> reader(memory,0);", and defaults to MicrochipSRAM. Added       **
+  ** v1.0.21.                                                                                                     **
+  *****************************************************************************************************************/
+  template<class Memory> class SRAMCursor {                                   // Common part of reader and writer //
+    public:                                                                   // Publicly visible methods         //
+      ~SRAMCursor() { end(); }                                                // Class destructor ends transfer   //
+      void     begin(const uint32_t addr) {                                   // Start a new transaction at addr  //
+        end();                                                                // End the current one first        //
+        _Address = addr&_Memory.addressMask();                                // Wrap the start address           //
+        _Memory.beginCommand(_Command,_Address);                              // Select chip, send command & addr //
+        _Open = true;                                                         //                                  //
+      } // of method begin                                                    //----------------------------------//
+      void     end() {                                                        // End the transaction by pulling   //
+        if (_Open) _Memory._Transport.deselect();                             // CS/SS high and releasing the     //
+        _Open = false;                                                        // SPI bus                          //
+      } // of method end                                                      //----------------------------------//
+      uint32_t address() const { return _Address; }                           // Address of the next byte         //
+    protected:                                                                // Used by derived classes          //
+      SRAMCursor(Memory &memory,const uint8_t command,const uint32_t addr)    // Class constructor starts the     //
+        : _Memory(memory), _Command(command) { begin(addr); }                 // first transaction                //
+      SRAMCursor(const SRAMCursor &) = delete;                                // Can't be copied as only one      //
+      SRAMCursor &operator=(const SRAMCursor &) = delete;                     // may deselect the memory          //
+      void     transfer(void *buffer,const uint32_t bytes) {                  // Read or write bytes from/to the  //
+        if (!_Open) begin(_Address);                                          // memory, restarting after end()   //
+        if (_Command==SRAM_READ_CODE) _Memory._Transport.read(buffer,bytes);  //                                  //
+                                 else _Memory._Transport.write(buffer,bytes); //                                  //
+        _Address = (_Address+bytes)&_Memory.addressMask();                    // Wrap like the memory does        //
+      } // of method transfer                                                 //----------------------------------//
+      Memory  &_Memory;                                                       // Memory being read or written     //
+      uint32_t _Address = 0;                                                  // Address of the next byte         //
+      uint8_t  _Command;                                                      // SRAM_READ_CODE or WRITE_CODE     //
+      bool     _Open    = false;                                              // True while CS/SS is held low     //
+  }; // of SRAMCursor class definition                                        //                                  //
+  template<class Memory = MicrochipSRAM>                                      // Cursor reading a sequence of     //
+  class SRAMReader : public SRAMCursor<Memory> {                              // variables in one transaction     //
+    public:                                                                   // Publicly visible methods         //
+      SRAMReader(Memory &memory,const uint32_t addr)                          // Class constructor                //
+        : SRAMCursor<Memory>(memory,SRAM_READ_CODE,addr) {}                   //                                  //
+      template<typename T> T read() {                                         // Read and return the next value   //
+        T value;                                                              //                                  //
+        read(value);                                                          //                                  //
+        return value;                                                         //                                  //
+      } // of method read                                                     //----------------------------------//
+      template<typename T> uint32_t read(T &value) {                          // Read the next value and return   //
+        this->transfer(&value,sizeof(T));                                     // the following address            //
+        return this->_Address;                                                //                                  //
+      } // of method read                                                     //----------------------------------//
+      uint32_t read(void *buffer,const uint32_t bytes) {                      // Read a block of bytes            //
+        this->transfer(buffer,bytes);                                         //                                  //
+        return this->_Address;                                                //                                  //
+      } // of method read                                                     //----------------------------------//
+  }; // of SRAMReader class definition                                        //                                  //
+  template<class Memory = MicrochipSRAM>                                      // Cursor writing a sequence of     //
+  class SRAMWriter : public SRAMCursor<Memory> {                              // variables in one transaction     //
+    public:                                                                   // Publicly visible methods         //
+      SRAMWriter(Memory &memory,const uint32_t addr)                          // Class constructor                //
+        : SRAMCursor<Memory>(memory,SRAM_WRITE_CODE,addr) {}                  //                                  //
+      template<typename T> uint32_t write(const T &value) {                   // Write the next value and return  //
+        this->transfer((void *)&value,sizeof(T));                             // the following address            //
+        return this->_Address;                                                //                                  //
+      } // of method write                                                    //----------------------------------//
+      uint32_t write(const void *buffer,const uint32_t bytes) {               // Write a block of bytes           //
+        this->transfer((void *)buffer,bytes);                                 //                                  //
+        return this->_Address;                                                //                                  //
+      } // of method write                                                    //----------------------------------//
+  }; // of SRAMWriter class definition                                        //                                  //
+  /*****************************************************************************************************************
+  ** The SRAMCache class template is an optional write-back cache in MCU RAM for many small read-modify-write     **
+  ** accesses to the same data, e.g. counters or state structures. It has "LINES" lines of SRAM_PAGE_BYTES bytes, **
+  ** which is the chips' page size, and get() and put() are served from the lines without any bus traffic once a  **
+  ** page is cached. When a page isn't cached the least recently used line is replaced, and is written back to    **
+  ** the memory in one burst first if it has been changed. A put() covering a whole page doesn't read the page    **
+  ** first.                                                                                                       **
+  ** Changed lines are only written to the memory by flush(), when they are replaced or when the cache is         **
+  ** destroyed, so flush() has to be called before the memory is accessed directly or the power may be lost.      **
+  ** invalidate() writes back and then forgets all lines, and is needed after the memory has been changed without **
+  ** using the cache. The hits, misses and writeBacks counters show how well the cache works for a sketch. Each   **
+  ** line uses SRAM_PAGE_BYTES+7 bytes of RAM. Added v1.0.22.                                                     **
+  *****************************************************************************************************************/
+  template<class Memory = MicrochipSRAM, uint8_t LINES = 4>                   // Write-back cache with "LINES"    //
+  class SRAMCache {                                                           // lines of one page each           //
+    public:                                                                   // Publicly visible methods         //
+      SRAMCache(Memory &memory) : _Memory(memory) {                           // Class constructor, all lines     //
+        for (uint8_t i=0;i<LINES;i++) {                                       // start empty and in order of age  //
+          _Valid[i] = false;                                                  //                                  //
+          _Dirty[i] = false;                                                  //                                  //
+          _Age[i]   = i;                                                      //                                  //
+        } // of for-next each line                                            //                                  //
+      } // of class constructor                                               //----------------------------------//
+      ~SRAMCache() { flush(); }                                               // Destructor writes changed lines  //
+      template<typename T> uint32_t get(const uint32_t addr,T &value) {       // Read a structure through cache   //
+        return access(addr,&value,sizeof(T),false);                           //                                  //
+      } // of method get                                                      //----------------------------------//
+      template<typename T> uint32_t put(const uint32_t addr,const T &value) { // Write a structure to the cache   //
+        return access(addr,(void *)&value,sizeof(T),true);                    //                                  //
+      } // of method put                                                      //----------------------------------//
+      void     flush() {                                                      // Write all changed lines back to  //
+        for (uint8_t i=0;i<LINES;i++) writeBack(i);                           // the memory, keeping them cached  //
+      } // of method flush                                                    //----------------------------------//
+      void     invalidate() {                                                 // Write back and then forget all   //
+        flush();                                                              // lines                            //
+        for (uint8_t i=0;i<LINES;i++) _Valid[i] = false;                      //                                  //
+      } // of method invalidate                                               //----------------------------------//
+      uint32_t hits       = 0;                                                // Accesses served from a line      //
+      uint32_t misses     = 0;                                                // Accesses that replaced a line    //
+      uint32_t writeBacks = 0;                                                // Changed lines written to memory  //
+    private:                                                                  // Private variables and methods    //
+      uint32_t access(uint32_t addr,void *buffer,uint32_t bytes,              // Copy bytes between the buffer    //
+                      const bool write) {                                     // and the lines, page by page      //
+        const uint32_t mask = _Memory.SRAMBytes-1;                            // Wrap like the memory does        //
+        uint8_t *data = (uint8_t *)buffer;                                    //                                  //
+        addr &= mask;                                                         //                                  //
+        while (bytes>0) {                                                     // Loop over each page touched      //
+          const uint8_t offset = addr%SRAM_PAGE_BYTES;                        // Offset within the page and bytes //
+          const uint8_t chunk  = (bytes<(uint32_t)(SRAM_PAGE_BYTES-offset)) ? // up to the end of the page        //
+                                 bytes : SRAM_PAGE_BYTES-offset;              //                                  //
+          const uint8_t line   = findLine(addr-offset,                        // A whole page written needn't be  //
+                                          !write||chunk<SRAM_PAGE_BYTES);     // read first                       //
+          if (write) {                                                        // Copy into the line and mark it   //
+            memcpy(&_Data[line][offset],data,chunk);                          // as changed                       //
+            _Dirty[line] = true;                                              //                                  //
+          } else memcpy(data,&_Data[line][offset],chunk);                     // or copy out of the line          //
+          data  += chunk;                                                     //                                  //
+          bytes -= chunk;                                                     //                                  //
+          addr   = (addr+chunk)&mask;                                         //                                  //
+        } // of while-loop each page                                          //                                  //
+        return addr;                                                          // Return the computed new address  //
+      } // of method access                                                   //----------------------------------//
+      uint8_t  findLine(const uint32_t page,const bool fill) {                // Return the line holding "page",  //
+        uint8_t line = 0;                                                     // replacing the least recently     //
+        for (uint8_t i=0;i<LINES;i++) {                                       // used line if it isn't cached     //
+          if (_Valid[i] && _Page[i]==page) {                                  // Cached, so use the line          //
+            hits++;                                                           //                                  //
+            touch(i);                                                         //                                  //
+            return i;                                                         //                                  //
+          } // of if-then page found                                          //                                  //
+          if (_Age[i]>_Age[line]) line = i;                                   // Remember the oldest line         //
+        } // of for-next each line                                            //                                  //
+        misses++;                                                             //                                  //
+        writeBack(line);                                                      // Save the old page if changed     //
+        if (fill) _Memory.get(page,_Data[line]);                              // Read the whole page in one burst //
+        _Page[line]  = page;                                                  //                                  //
+        _Valid[line] = true;                                                  //                                  //
+        touch(line);                                                          //                                  //
+        return line;                                                          //                                  //
+      } // of method findLine                                                 //----------------------------------//
+      void     touch(const uint8_t line) {                                    // Make "line" the most recently    //
+        for (uint8_t i=0;i<LINES;i++) if (_Age[i]<_Age[line]) _Age[i]++;      // used, ageing the lines which     //
+        _Age[line] = 0;                                                       // were used more recently          //
+      } // of method touch                                                    //----------------------------------//
+      void     writeBack(const uint8_t line) {                                // Write a changed line back to the //
+        if (!_Valid[line] || !_Dirty[line]) return;                           // memory in one burst              //
+        _Memory.put(_Page[line],_Data[line]);                                 //                                  //
+        _Dirty[line] = false;                                                 //                                  //
+        writeBacks++;                                                         //                                  //
+      } // of method writeBack                                                //----------------------------------//
+      Memory  &_Memory;                                                       // Memory being cached              //
+      uint32_t _Page[LINES];                                                  // Page address held by each line   //
+      uint8_t  _Data[LINES][SRAM_PAGE_BYTES];                                 // Contents of each line            //
+      uint8_t  _Age[LINES];                                                   // 0 for the most recently used     //
+      bool     _Valid[LINES];                                                 // Line holds a page                //
+      bool     _Dirty[LINES];                                                 // Line changed since written back  //
+  }; // of SRAMCache class definition                                         //                                  //
+  /*****************************************************************************************************************
+  ** The SRAMReadAhead class template speeds up reading arrays of small records with get(). Once a get() starts   **
+  ** at the address following the previous one, the next "WINDOW" bytes are read in one burst into MCU RAM and    **
+  ** the following get() calls are served from there until the window runs out, when the next window is read.     **
+  ** Random reads aren't prefetched and go directly to the memory. A put() writes directly to the memory and      **
+  ** discards the window if it overlaps it, as does invalidate(), which has to be called if the memory is written **
+  ** without using this class. The hits and fetches counters show how many get() calls were served from the       **
+  ** window and how many windows were read. Added v1.0.23.                                                        **
+  *****************************************************************************************************************/
+  template<class Memory = MicrochipSRAM, uint16_t WINDOW = 64>                // Prefetch "WINDOW" bytes when     //
+  class SRAMReadAhead {                                                       // reads are sequential             //
+    public:                                                                   // Publicly visible methods         //
+      SRAMReadAhead(Memory &memory) : _Memory(memory) {}                      // Class constructor                //
+      template<typename T> uint32_t get(const uint32_t addr,T &value) {       // Read a structure, from the       //
+        const uint32_t mask  = _Memory.SRAMBytes-1;                           // window if possible               //
+        const uint32_t start = addr&mask;                                     //                                  //
+        const bool sequential = (start==_NextAddress);                        // Follows the previous get()       //
+        _NextAddress = (start+sizeof(T))&mask;                                //                                  //
+        if (sizeof(T)>WINDOW) return _Memory.get(start,value);                // Too big to prefetch              //
+        uint32_t offset = (start-_Start)&mask;                                // Position within the window       //
+        if (offset>=_Bytes || offset+sizeof(T)>_Bytes) {                      // Not in the window, so read the   //
+          if (!sequential) return _Memory.get(start,value);                   // next window if reading in order  //
+          _Memory.get(start,_Window);                                         // or directly otherwise            //
+          _Start = start;                                                     //                                  //
+          _Bytes = WINDOW;                                                    //                                  //
+          offset = 0;                                                         //                                  //
+          fetches++;                                                          //                                  //
+        } else hits++;                                                        //                                  //
+        memcpy(&value,&_Window[offset],sizeof(T));                            // Copy from the window             //
+        return _NextAddress;                                                  // Return the computed new address  //
+      } // of method get                                                      //----------------------------------//
+      template<typename T> uint32_t put(const uint32_t addr,const T &value) { // Write a structure, discarding    //
+        const uint32_t mask  = _Memory.SRAMBytes-1;                           // the window if it overlaps        //
+        const uint32_t start = addr&mask;                                     //                                  //
+        if (((start-_Start)&mask)<_Bytes || ((_Start-start)&mask)<sizeof(T))  //                                  //
+          invalidate();                                                       //                                  //
+        return _Memory.put(start,value);                                      //                                  //
+      } // of method put                                                      //----------------------------------//
+      void     invalidate() { _Bytes = 0; }                                   // Discard the window               //
+      uint32_t hits    = 0;                                                   // get() calls served from window   //
+      uint32_t fetches = 0;                                                   // Windows read from the memory     //
+    private:                                                                  // Private variables and methods    //
+      Memory  &_Memory;                                                       // Memory being read                //
+      uint32_t _NextAddress = 0xFFFFFFFF;                                     // Address following last get()     //
+      uint32_t _Start       = 0;                                              // Memory address of the window     //
+      uint16_t _Bytes       = 0;                                              // Bytes in window, 0 when empty    //
+      uint8_t  _Window[WINDOW];                                               // Bytes read ahead                 //
+  }; // of SRAMReadAhead class definition                                     //                                  //
+  /*****************************************************************************************************************
+  ** The SRAMWriteCombiner class template collects put() calls to consecutive addresses, e.g. the fields of a log **
+  ** record written one at a time, in a buffer of "BUFFER" bytes in MCU RAM and writes them to the memory in one  **
+  ** transaction. The buffer is written when a put() isn't at the address following the previous one, when it is  **
+  ** full, when flush() is called, before a get() through this class and when the object is destroyed. A value    **
+  ** which doesn't fit into the rest of the buffer is split, and one larger than the buffer is written directly.  **
+  ** "puts" counts the put() calls, "writes" the transactions used and "combined" the put() calls which didn't    **
+  ** start a transaction, so once the buffer has been written "combined" is "puts" minus "writes", the number of  **
+  ** transactions saved. flush() has to be called before the memory is accessed directly. Added v1.0.24.          **
+  *****************************************************************************************************************/
+  template<class Memory = MicrochipSRAM, uint16_t BUFFER = 32>                // Combine consecutive put() calls  //
+  class SRAMWriteCombiner {                                                   // into one transaction             //
+    public:                                                                   // Publicly visible methods         //
+      SRAMWriteCombiner(Memory &memory) : _Memory(memory) {}                  // Class constructor                //
+      ~SRAMWriteCombiner() { flush(); }                                       // Destructor writes the buffer     //
+      template<typename T> uint32_t put(const uint32_t addr,const T &value) { // Add a structure to the buffer    //
+        const uint32_t mask  = _Memory.SRAMBytes-1;                           //                                  //
+        const uint32_t start = addr&mask;                                     //                                  //
+        puts++;                                                               //                                  //
+        if (sizeof(T)>BUFFER) {                                               // Too big to combine, so write it  //
+          flush();                                                            // directly after the buffer        //
+          writes++;                                                           //                                  //
+          return _Memory.put(start,value);                                    //                                  //
+        } // of if-then too big for the buffer                                //                                  //
+        bool started = false;                                                 // True if a transaction is started //
+        if (_Bytes==0 || start!=((_Start+_Bytes)&mask)) {                     // Not adjacent to the buffer, so   //
+          flush();                                                            // start a new one                  //
+          _Start  = start;                                                    //                                  //
+          started = true;                                                     //                                  //
+        } // of if-then not adjacent                                          //                                  //
+        const uint8_t *data = (const uint8_t *)&value;                        //                                  //
+        for (uint16_t left=sizeof(T);left>0;) {                               // Copy as much as fits, writing    //
+          uint16_t chunk = BUFFER-_Bytes;                                     // the buffer whenever it is full   //
+          if (chunk>left) chunk = left;                                       //                                  //
+          memcpy(&_Buffer[_Bytes],data,chunk);                                //                                  //
+          _Bytes += chunk;                                                    //                                  //
+          data   += chunk;                                                    //                                  //
+          left   -= chunk;                                                    //                                  //
+          if (_Bytes==BUFFER) {                                               // Buffer full, so write it and     //
+            flush();                                                          // continue at the next address     //
+            _Start = (start+sizeof(T)-left)&mask;                             // in a new transaction if any      //
+            if (left>0) started = true;                                       // bytes are left                   //
+          } // of if-then buffer full                                         //                                  //
+        } // of for-next each chunk                                           //                                  //
+        if (!started) combined++;                                             // Saved a transaction              //
+        return (start+sizeof(T))&mask;                                        // Return the computed new address  //
+      } // of method put                                                      //----------------------------------//
+      template<typename T> uint32_t get(const uint32_t addr,T &value) {       // Write the buffer and then read   //
+        flush();                                                              // a structure                      //
+        return _Memory.get(addr,value);                                       //                                  //
+      } // of method get                                                      //----------------------------------//
+      void     flush() {                                                      // Write the buffer in one          //
+        if (_Bytes==0) return;                                                // transaction                      //
+        SRAMConstSegment segment = {_Buffer,_Bytes,0};                        //                                  //
+        _Memory.putv(_Start,&segment,1);                                      //                                  //
+        _Bytes = 0;                                                           //                                  //
+        writes++;                                                             //                                  //
+      } // of method flush                                                    //----------------------------------//
+      uint32_t puts     = 0;                                                  // Number of put() calls            //
+      uint32_t combined = 0;                                                  // Transactions saved               //
+      uint32_t writes   = 0;                                                  // Transactions used                //
+    private:                                                                  // Private variables and methods    //
+      Memory  &_Memory;                                                       // Memory being written             //
+      uint32_t _Start = 0;                                                    // Memory address of the buffer     //
+      uint16_t _Bytes = 0;                                                    // Bytes collected, 0 when empty    //
+      uint8_t  _Buffer[BUFFER];                                               // Bytes to be written              //
+  }; // of SRAMWriteCombiner class definition                                 //                                  //
+  /*****************************************************************************************************************
+  ** The SRAMLazyClear class template makes clearing the memory instant. A bitmap in MCU RAM has one bit for each **
+  ** page of SRAM_PAGE_BYTES bytes, which is set when the page is known to hold the clear value. clearMemory()    **
+  ** only sets the bits of the whole pages cleared and the memory itself is left unchanged, get() returns the     **
+  ** clear value for marked pages without any bus traffic and put() fills the marked pages it only partly covers  **
+  ** before writing and unmarks them. "MEMORY_BYTES" is the largest memory size used and sets the bitmap size,    **
+  ** which is 512 bytes for the 23x1024 and 64 bytes for a 23x640; any memory above it is cleared directly.       **
+  ** flush() fills all marked pages in the memory and has to be called before the memory is accessed without      **
+  ** using this class. Clearing to a value different from the last one first fills the pages still marked with    **
+  ** the old value. The "hits" counter is the number of bytes read from marked pages. Added v1.0.25.              **
+  *****************************************************************************************************************/
+  template<class Memory = MicrochipSRAM, uint32_t MEMORY_BYTES = SRAM_1024>   // Defer clearing pages of memory   //
+  class SRAMLazyClear {                                                       // until they are written           //
+    public:                                                                   // Publicly visible methods         //
+      SRAMLazyClear(Memory &memory) : _Memory(memory) {                       // Class constructor, no page is    //
+        memset(_Marked,0,sizeof(_Marked));                                    // known to be cleared yet          //
+        const uint32_t bytes = (_Memory.SRAMBytes<MEMORY_BYTES) ?             // Pages covered by the bitmap      //
+                               _Memory.SRAMBytes : MEMORY_BYTES;              //                                  //
+        _Pages = bytes/SRAM_PAGE_BYTES;                                       //                                  //
+      } // of class constructor                                               //----------------------------------//
+      void     clearMemory(const uint8_t clearValue = 0) {                    // Clear all memory to one value by //
+        memset(_Marked,0xFF,sizeof(_Marked));                                 // marking every page, so no old    //
+        _ClearValue = clearValue;                                             // value needs to be filled first   //
+        const uint32_t bitmapBytes = _Pages*SRAM_PAGE_BYTES;                  // Memory above the bitmap is       //
+        if (_Memory.SRAMBytes>bitmapBytes)                                    // cleared directly                 //
+          _Memory.clearMemory(bitmapBytes,_Memory.SRAMBytes-bitmapBytes,      //                                  //
+                              clearValue);                                    //                                  //
+      } // of method clearMemory                                              //----------------------------------//
+      void     clearMemory(uint32_t start,uint32_t length,                    // Mark whole pages from "start" as //
+                           const uint8_t clearValue = 0) {                    // cleared, filling partial pages   //
+        const uint32_t mask = _Memory.SRAMBytes-1;                            //                                  //
+        if (clearValue!=_ClearValue) {                                        // Pages marked with another value  //
+          flush();                                                            // have to be filled first          //
+          _ClearValue = clearValue;                                           //                                  //
+        } // of if-then new clear value                                       //                                  //
+        start &= mask;                                                        //                                  //
+        while (length>0) {                                                    // Loop over each page touched      //
+          const uint32_t page = start/SRAM_PAGE_BYTES;                        //                                  //
+          uint32_t chunk = SRAM_PAGE_BYTES-start%SRAM_PAGE_BYTES;             // Bytes up to the end of the page  //
+          if (page>=_Pages) chunk = _Memory.SRAMBytes-start;                  // or of the memory, without bits   //
+          if (chunk>length) chunk = length;                                   //                                  //
+          if (chunk==SRAM_PAGE_BYTES && page<_Pages) mark(page,true);         // Just mark whole pages, and fill  //
+          else if (page>=_Pages || !marked(page))                             // the others                       //
+            _Memory.clearMemory(start,chunk,clearValue);                      //                                  //
+          start   = (start+chunk)&mask;                                       //                                  //
+          length -= chunk;                                                    //                                  //
+        } // of while-loop each page                                          //                                  //
+      } // of method clearMemory                                              //----------------------------------//
+      template<typename T> uint32_t get(const uint32_t addr,T &value) {       // Read a structure, using the      //
+        const uint32_t mask = _Memory.SRAMBytes-1;                            // clear value for marked pages     //
+        uint32_t start = addr&mask;                                           //                                  //
+        uint8_t *data  = (uint8_t *)&value;                                   //                                  //
+        for (uint32_t left=sizeof(T);left>0;) {                               // Loop over runs of pages which    //
+          const bool cleared = marked(start/SRAM_PAGE_BYTES);                 // are all either marked or not     //
+          uint32_t end = start, run = 0;                                      //                                  //
+          do {                                                                // Extend run up to a page with the //
+            uint32_t chunk = SRAM_PAGE_BYTES-end%SRAM_PAGE_BYTES;             // other state or the end of the    //
+            if (chunk>left-run) chunk = left-run;                             // memory                           //
+            run += chunk;                                                     //                                  //
+            end += chunk;                                                     //                                  //
+          } while (run<left && end<=mask &&                                   //                                  //
+                   marked(end/SRAM_PAGE_BYTES)==cleared);                     //                                  //
+          if (cleared) {                                                      // Marked pages are served from     //
+            memset(data,_ClearValue,run);                                     // MCU RAM                          //
+            hits += run;                                                      //                                  //
+          } else {                                                            // the others are read in one       //
+            SRAMSegment segment = {data,run,0};                               // transaction                      //
+            _Memory.getv(start,&segment,1);                                   //                                  //
+          } // of if-then-else pages marked                                   //                                  //
+          data  += run;                                                       //                                  //
+          left  -= run;                                                       //                                  //
+          start  = (start+run)&mask;                                          //                                  //
+        } // of for-next each run                                             //                                  //
+        return start;                                                         // Return the computed new address  //
+      } // of method get                                                      //----------------------------------//
+      template<typename T> uint32_t put(const uint32_t addr,const T &value) { // Write a structure, filling the   //
+        const uint32_t mask = _Memory.SRAMBytes-1;                            // marked pages partly written      //
+        uint32_t start = addr&mask;                                           //                                  //
+        for (uint32_t left=sizeof(T);left>0;) {                               // Loop over each page touched      //
+          const uint32_t page = start/SRAM_PAGE_BYTES;                        //                                  //
+          uint32_t chunk = SRAM_PAGE_BYTES-start%SRAM_PAGE_BYTES;             //                                  //
+          if (chunk>left) chunk = left;                                       //                                  //
+          if (marked(page)) {                                                 // The page is no longer all clear  //
+            if (chunk<SRAM_PAGE_BYTES)                                        // and unless it's all written its  //
+              _Memory.clearMemory(page*SRAM_PAGE_BYTES,SRAM_PAGE_BYTES,       // other bytes are filled now       //
+                                  _ClearValue);                               //                                  //
+            mark(page,false);                                                 //                                  //
+          } // of if-then page marked                                         //                                  //
+          start  = (start+chunk)&mask;                                        //                                  //
+          left  -= chunk;                                                     //                                  //
+        } // of for-next each page                                            //                                  //
+        return _Memory.put(addr,value);                                       // Write in one transaction         //
+      } // of method put                                                      //----------------------------------//
+      void     flush() {                                                      // Fill all marked pages, merging   //
+        for (uint32_t page=0;page<_Pages;) {                                  // adjacent ones into one fill      //
+          if (!marked(page)) { page++; continue; }                            //                                  //
+          uint32_t run = 0;                                                   //                                  //
+          while (page+run<_Pages && marked(page+run)) mark(page+run++,false); //                                  //
+          _Memory.clearMemory(page*SRAM_PAGE_BYTES,run*SRAM_PAGE_BYTES,       //                                  //
+                              _ClearValue);                                   //                                  //
+          page += run;                                                        //                                  //
+        } // of for-next each page                                            //                                  //
+      } // of method flush                                                    //----------------------------------//
+      uint32_t hits = 0;                                                      // Bytes read from marked pages     //
+    private:                                                                  // Private variables and methods    //
+      bool     marked(const uint32_t page) const {                            // True if the page is known to     //
+        return page<_Pages && (_Marked[page/8]&(1<<(page%8)));                // hold the clear value             //
+      } // of method marked                                                   //----------------------------------//
+      void     mark(const uint32_t page,const bool cleared) {                 // Set or reset a page's bit        //
+        if (cleared) _Marked[page/8] |= (1<<(page%8));                        //                                  //
+                else _Marked[page/8] &= ~(1<<(page%8));                       //                                  //
+      } // of method mark                                                     //----------------------------------//
+      Memory  &_Memory;                                                       // Memory being cleared             //
+      uint32_t _Pages      = 0;                                               // Pages covered by the bitmap      //
+      uint8_t  _ClearValue = 0;                                               // Value of the marked pages        //
+      uint8_t  _Marked[(MEMORY_BYTES/SRAM_PAGE_BYTES+7)/8];                   // One bit for each page            //
+  }; // of SRAMLazyClear class definition                                     //                                  //
+  /*****************************************************************************************************************
+  ** Class Constructor instantiates the class. The transport is initialized and the memory is switched to         **
+  ** sequential mode. If the memory size isn't known when compiling then it is detected, see detectMemory()       **
+  ** (v1.0.10). A 23x512 or 23x1024 stays in SDI or SQI mode through a reset of the MCU, so first all of the      **
+  ** transport's data lines are held high for 8 clock cycles. The chip reads this as RSTIO in any mode, which     **
+  ** returns it to SPI mode and is ignored in SPI mode (v1.0.29).                                                 **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              // CONSTRUCTOR - Instantiate class  //
+  MicrochipSRAMBase<Transport,CHIP_BYTES>::MicrochipSRAMBase(                 //                                  //
+    const Transport &transport)                                               //                                  //
+    : _Transport(transport) {                                                 // Store a copy of the transport    //
+    _Transport.begin();                                                       // Set up the bus and CS/SS pin     //
+    _Transport.setBusWidth(Transport::MAX_BUS_WIDTH);                         // RSTIO on all lines for 8 clock   //
+    _Transport.select();                                                      // cycles, so that the chip reads   //
+    for (uint8_t i=0;i<Transport::MAX_BUS_WIDTH;i++)                          // it whichever mode it's in        //
+      _Transport.transfer(SRAM_RSTIO_CODE);                                   //                                  //
+    _Transport.deselect();                                                    //                                  //
+    _Transport.setBusWidth(SRAM_SPI_BUS);                                     // Back to SPI for the transport    //
+    _Transport.select();                                                      // Select by pulling CS pin low     //
+    _Transport.transfer(SRAM_WRITE_MODE_REG);                                 // Next byte writes mode register   //
+    _Transport.transfer(SRAM_SEQ_MODE);                                       // Turn on sequential mode          //
+    _Transport.deselect();                                                    // Deselect by pulling CS pin high  //
+    if (CHIP_BYTES) SRAMBytes = CHIP_BYTES;                                   // Either use the known size or     //
+               else detectMemory();                                           // detect the memory size           //
+    if (SRAMBytes) _AddressMask = SRAMBytes-1;                                // All sizes are powers of two, so  //
+                                                                              // mask instead of modulo to wrap   //
+  } // of class constructor                                                   //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method detectMemory determines which memory chip is attached by performing some read and write operations,   **
+  ** see the description at the top of this file. SRAMBytes is set to the memory size or to 0 if no chip was      **
+  ** found. Moved from the constructor in v1.0.10.                                                                **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  void MicrochipSRAMBase<Transport,CHIP_BYTES>::detectMemory() {              // Find the size of the memory      //
+    /***************************************************************************************************************
+    ** Firstly write 0x00, 0x00, 0x00, 0x5A in write mode. With 3 address bytes 0x5A is written to address 0,     **
+    ** with 2 address bytes 0x00 is written to the first and 0x5A to the second memory position. Then write 0x00, **
+    ** 0x00, 0x01, 0xFF, which writes 0xFF to address 1 with 3 address bytes or 0x01 and 0xFF to the first two    **
+    ** memory positions with 2 address bytes. Finally read from address 0x00, 0x00, 0x00. With 3 address bytes    **
+    ** the first byte read is the 0x5A at address 0, with 2 address bytes the 4th address byte has already        **
+    ** returned the first memory position and the byte read is the 0xFF at address 1. So reading 0x5A is a        **
+    ** positive 1Mbit id, otherwise we continue searching. Before v1.0.9 0x01 was used as the last address byte   **
+    ** when reading, which returned 0xFF for all memories and so every chip was identified as a 1Mbit one.        **
+    ***************************************************************************************************************/
+    _Transport.select();                                                      // Select by pulling CS low         //
+    _Transport.transfer(SRAM_WRITE_CODE);                                     // Send the command for WRITE mode  //
+    for (uint8_t i=0;i<3;i++) _Transport.transfer(0x00);                      // Write zeros for address & data   //
+    _Transport.transfer(0x5A);                                                // 1st or 2nd data byte             //
+    _Transport.deselect();                                                    // Deselect by pulling CS high      //
+    _Transport.select();                                                      // Select by pulling CS low         //
+    _Transport.transfer(SRAM_WRITE_CODE);                                     // Send the command for WRITE mode  //
+    _Transport.transfer(0x00);                                                // Send the 1st address byte        //
+    _Transport.transfer(0x00);                                                // Send the 2nd address byte        //
+    _Transport.transfer(0x01);                                                // LSB of address or 1st data byte  //
+    _Transport.transfer(0xFF);                                                // 1st or 2nd data byte             //
+    _Transport.deselect();                                                    // Deselect by pulling CS high      //
+    _Transport.select();                                                      // Select by pulling CS low         //
+    _Transport.transfer(SRAM_READ_CODE);                                      // Send the command for READ mode   //
+    _Transport.transfer(0x00);                                                // Send the 1st address byte        //
+    _Transport.transfer(0x00);                                                // Send the 2nd address byte        //
+    _Transport.transfer(0x00);                                                // LSB of address or 1st data byte  //
+    SRAMBytes = _Transport.transfer(0x00);                                    // Read 1 byte from the memory      //
+    _Transport.deselect();                                                    // Deselect by pulling CS high      //
+    if (SRAMBytes==0x5A) SRAMBytes = SRAM_1024;                               // Set the memory size to 128KB     //
+    else {                                                                    // Otherwise keep on identifying    //
+      /*************************************************************************************************************
+      ** Now that we know that we have a 2-byte addressable memory chip, write 0xFF to the potentially last byte  **
+      ** of the memory chip and the one after it. Then read the first byte, if it contains the 0xFF we've just    **
+      ** written then we know that an overflow has occurred and therefore know the chip size. If the first byte   **
+      ** is still 0, go to the next memory chip size until we've determined the chip; if we haven't gotten it     **
+      ** then odds are that there's no memory chip attached or the CS/SS pin is incorrect - return a 0 to denote  **
+      ** this problem. Note - at the time of writing there is no Microchip 128kbit chip, but the size is left in  **
+      ** for future compatibility.                                                                                **
+      *************************************************************************************************************/
+      const uint32_t chipSizes[] = {SRAM_64,SRAM_128,SRAM_256,SRAM_512};      // Sizes with 2 address bytes       //
+      uint8_t firstByte = 0;                                                  // Value read from address 0        //
+      SRAMBytes = 0;                                                          // Stays 0 if no chip is found      //
+      put(0,(uint8_t)0x00);                                                   // Write zero to first byte         //
+      for (uint8_t i=0;i<4 && SRAMBytes==0;i++) {                             // Check each size, smallest first  //
+        put(chipSizes[i]-1,(uint16_t)0xFFFF);                                 // Put 0xFF at last & last+1        //
+        get(0,firstByte);                                                     // Read first byte back and if it   //
+        if (firstByte==0xFF) SRAMBytes = chipSizes[i];                        // changed we've found the size     //
+      } // of for-next each possible memory size                              //                                  //
+    } // of if-then-else we have a positive 1mbit ID                          //                                  //
+  } // of method detectMemory                                                 //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method clearMemory to set all memory positions to the same value. Added v1.0.1.                              **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  void MicrochipSRAMBase<Transport,CHIP_BYTES>::clearMemory(                  // Clear all memory to one value    //
+    const uint8_t clearValue) {                                               //                                  //
+    clearMemory(0,SRAMBytes,clearValue);                                      // Clear the whole memory range     //
+  } // of method ClearMemory                                                  //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method clearMemory with a start address and length sets "length" bytes starting at "start" to the same       **
+  ** value, wrapping around at the end of memory, e.g. to clear a ring buffer or frame. It is a fillMemory() of   **
+  ** the byte value, so the bytes are sent in one transaction from a buffer of SRAM_BLOCK_SIZE bytes rather than  **
+  ** with one transfer() call per byte as was done up to v1.0.13. Added v1.0.14.                                  **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  void MicrochipSRAMBase<Transport,CHIP_BYTES>::clearMemory(                  // Clear "length" bytes from        //
+    const uint32_t start,const uint32_t length,const uint8_t clearValue) {    // "start" to one value             //
+    fillMemory(start,clearValue,length);                                      // A length of 0 writes nothing     //
+  } // of method clearMemory                                                  //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method beginCommand selects the memory and sends the command byte followed by 2 or 3 address bytes,          **
+  ** depending upon the memory in use. All of the read and write methods start their transfer with this call and  **
+  ** end it with a call to the transport's deselect(). An asynchronous transfer still running is finished first.  **
+  ** In SDI and SQI mode a read is followed by a dummy byte, during which the data lines change direction. Added  **
+  ** v1.0.4. The mode register is set to "mode" first if it isn't already in use, which is sequential mode for    **
+  ** all methods except getPage() and putPage() (v1.0.26). The dummy byte test starts with the transport's        **
+  ** MAX_BUS_WIDTH, so it is removed at compile time for an SPI-only transport (v1.0.30).                         **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  void MicrochipSRAMBase<Transport,CHIP_BYTES>::beginCommand(                 // Select chip, send command and    //
+    const uint8_t command,const uint32_t addr,const uint8_t mode) {           // address in the given mode        //
+    while (!asyncDone()) {}                                                   // Finish any async transfer first  //
+    writeMode(mode);                                                          // Only writes the register if the  //
+                                                                              // mode changes                     //
+    _Transport.select();                                                      // Select by pulling CS low         //
+    _Transport.transfer(command);                                             // Send the READ or WRITE command   //
+    if (wideAddress()) _Transport.transfer((uint8_t)(addr>>16));              // Send the MSB of 24bit address    //
+    _Transport.transfer((uint8_t)(addr>>8));                                  // Send the 2nd byte of address     //
+    _Transport.transfer((uint8_t)addr);                                       // Send the LSB of the address      //
+    if (Transport::MAX_BUS_WIDTH>1 && command==SRAM_READ_CODE &&              // SDI and SQI reads have a dummy   //
+        _BusWidth!=SRAM_SPI_BUS)                                              // byte to turn the bus around, a   //
+      _Transport.transfer(0x00);                                              // constant false for SPI-only      //
+  } // of method beginCommand                                                 //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method setBusMode switches the memory and the transport to use 1 (SPI), 2 (SDI, dual I/O) or 4 (SQI, quad    **
+  ** I/O) data lines, giving twice or four times the bandwidth of SPI at the same clock speed. The EDIO and EQIO  **
+  ** instructions are only supported by the 23x512 and 23x1024 and not by the 23x640, 23x256 or the battery       **
+  ** backed 23LCV parts, and the transport has to support the number of lines. False is returned if the mode      **
+  ** can't be used and the current mode is then kept. Leaving SDI or SQI mode is done by sending RSTIO in the     **
+  ** current mode, and switching directly between SDI and SQI goes through SPI mode. Added v1.0.12.               **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  bool MicrochipSRAMBase<Transport,CHIP_BYTES>::setBusMode(                   // Switch to SPI, SDI or SQI access //
+    const uint8_t lines) {                                                    //                                  //
+    if (lines==_BusWidth) return true;                                        // Nothing to do if already in use  //
+    if (lines!=SRAM_SPI_BUS && lines!=SRAM_SDI_BUS && lines!=SRAM_SQI_BUS)    // Only 1, 2 and 4 lines exist      //
+      return false;                                                           //                                  //
+    if (lines>Transport::MAX_BUS_WIDTH) return false;                         // Transport must support it        //
+    if (lines!=SRAM_SPI_BUS &&                                                // Only the larger chips have SDI   //
+        (CHIP_BYTES ? CHIP_BYTES : SRAMBytes)<SRAM_512) return false;         // and SQI modes                    //
+    while (!asyncDone()) {}                                                   // Finish any async transfer first  //
+    if (_BusWidth!=SRAM_SPI_BUS) {                                            // Leave SDI or SQI mode by sending //
+      _Transport.select();                                                    // RSTIO on the lines in use and    //
+      _Transport.transfer(SRAM_RSTIO_CODE);                                   // then going back to SPI           //
+      _Transport.deselect();                                                  //                                  //
+      _Transport.setBusWidth(SRAM_SPI_BUS);                                   //                                  //
+      _BusWidth = SRAM_SPI_BUS;                                               //                                  //
+    } // of if-then leave SDI or SQI mode                                     //                                  //
+    if (lines!=SRAM_SPI_BUS) {                                                // Enter SDI or SQI mode using SPI  //
+      _Transport.select();                                                    // and then switch the transport    //
+      _Transport.transfer(lines==SRAM_SDI_BUS ? SRAM_EDIO_CODE                //                                  //
+                                              : SRAM_EQIO_CODE);              //                                  //
+      _Transport.deselect();                                                  //                                  //
+      _Transport.setBusWidth(lines);                                          //                                  //
+      _BusWidth = lines;                                                      //                                  //
+    } // of if-then enter SDI or SQI mode                                     //                                  //
+    return true;                                                              //                                  //
+  } // of method setBusMode                                                   //----------------------------------//
+  /*****************************************************************************************************************
+  ** Methods copy and move copy "length" bytes from address "src" to address "dst" within the memory, like        **
+  ** memcpy() and memmove(), and return the address following the last byte written. The data is read into a      **
+  ** buffer of SRAM_COPY_BYTES bytes with one READ and written back with one WRITE per chunk, rather than using a **
+  ** get() and put() per variable. Both regions wrap around at the end of memory. copy() always works from the    **
+  ** start of the region and so is only correct if the regions don't overlap, or if "dst" is below "src". move()  **
+  ** works from the end of the region when "dst" lies within the source region, so overlapping regions can be     **
+  ** shifted in either direction. Added v1.0.15.                                                                  **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::copy(const uint32_t dst,  // Copy a non-overlapping region    //
+    const uint32_t src,const uint32_t length) {                               // within the memory                //
+    return copyForward(*this,dst,src,length);                                 // Copy chunks from the start       //
+  } // of method copy                                                         //----------------------------------//
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::move(const uint32_t dst,  // Copy a region within the memory, //
+    const uint32_t src,const uint32_t length) {                               // which may overlap                //
+    const uint32_t distance = (dst-src)&addressMask();                        // How far "dst" is above "src"     //
+    if (distance==0 || distance>=length) return copy(dst,src,length);         // Safe to copy from the start      //
+    uint8_t buffer[SRAM_COPY_BYTES];                                          // Buffer for one chunk             //
+    for (uint32_t left=length;left>0;) {                                      // Copy chunks from the end of the  //
+      const uint16_t chunk = (left>SRAM_COPY_BYTES) ? SRAM_COPY_BYTES : left; // region back to the start, so no  //
+      left -= chunk;                                                          // byte is overwritten before it    //
+      copyChunk(*this,dst+left,src+left,buffer,chunk);                        // has been read                    //
+    } // of for-next each chunk                                               //                                  //
+    return (dst+length)&addressMask();                                        // Return the computed new address  //
+  } // of method move                                                         //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method copyTo copies "length" bytes from "srcAddr" in this memory to "dstAddr" in another memory instance,   **
+  ** e.g. to take a snapshot of a region on a second chip on the same bus. The data is moved in chunks of         **
+  ** SRAM_COPY_BYTES bytes, so each chunk needs one READ from this memory and one WRITE to the other. The other   **
+  ** memory may use a different transport or chip size, and if it is this memory then move() is used. The address **
+  ** in the other memory following the last byte written is returned. Added v1.0.16.                              **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  template<class Memory>                                                      //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::copyTo(Memory &other,     // Copy a region to another memory  //
+    const uint32_t srcAddr,const uint32_t dstAddr,const uint32_t length) {    //                                  //
+    if ((void*)&other==(void*)this) return move(dstAddr,srcAddr,length);      // Same memory, regions may overlap //
+    return copyForward(other,dstAddr,srcAddr,length);                         // Copy chunks from the start       //
+  } // of method copyTo                                                       //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method copyForward copies "length" bytes from "src" in this memory to "dst" in the target memory, one chunk  **
+  ** of up to SRAM_COPY_BYTES bytes at a time starting at the beginning of the region. Added v1.0.16.             **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  template<class Memory>                                                      //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::copyForward(              // Copy chunks from the start of a  //
+    Memory &target,const uint32_t dst,const uint32_t src,                     // region to any memory             //
+    const uint32_t length) {                                                  //                                  //
+    uint8_t buffer[SRAM_COPY_BYTES];                                          // Buffer for one chunk             //
+    for (uint32_t done=0;done<length;) {                                      // Copy chunks from the start of    //
+      const uint16_t chunk = (length-done>SRAM_COPY_BYTES) ? SRAM_COPY_BYTES  // the region onwards               //
+                                                           : length-done;     //                                  //
+      copyChunk(target,dst+done,src+done,buffer,chunk);                       //                                  //
+      done += chunk;                                                          //                                  //
+    } // of for-next each chunk                                               //                                  //
+    return (dst+length)&target.addressMask();                                 // Return the computed new address  //
+  } // of method copyForward                                                  //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method copyChunk reads "bytes" bytes from "src" into the buffer and writes them to "dst" in the target       **
+  ** memory, which is this memory for copy() and move(). Added v1.0.15.                                           **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  template<class Memory>                                                      //                                  //
+  void MicrochipSRAMBase<Transport,CHIP_BYTES>::copyChunk(Memory &target,     // Read one chunk into the buffer   //
+    const uint32_t dst,const uint32_t src,uint8_t *buffer,                    // and write it to the target       //
+    const uint16_t bytes) {                                                   //                                  //
+    beginCommand(SRAM_READ_CODE,src&addressMask());                           // Select chip, send READ & address //
+    _Transport.read(buffer,bytes);                                            // Read the whole chunk             //
+    _Transport.deselect();                                                    // Pull the SS/CS high to deselect  //
+    target.beginCommand(SRAM_WRITE_CODE,dst&target.addressMask());            // Select target, send WRITE & addr //
+    target._Transport.write(buffer,bytes);                                    // Write the whole chunk            //
+    target._Transport.deselect();                                             // Pull the SS/CS high to deselect  //
+  } // of method copyChunk                                                    //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method compare compares "length" bytes of the memory starting at "addr" with a buffer and returns the offset **
+  ** of the first byte which differs, or "length" if they are identical. The memory is read in one sequential     **
+  ** READ into a buffer of SRAM_COPY_BYTES bytes, one chunk at a time, so the data doesn't have to fit into RAM.  **
+  ** The read is stopped as soon as a difference is found. Added v1.0.17.                                         **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::compare(                  // Offset of the first difference   //
+    const uint32_t addr,const void *buffer,const uint32_t length) {           // to a buffer, length if none      //
+    const uint8_t *bytePtr = (const uint8_t*)buffer;                          // Pointer to buffer beginning      //
+    uint8_t chunkBuffer[SRAM_COPY_BYTES];                                     // Buffer for one chunk             //
+    uint32_t done = 0;                                                        // Bytes found to be identical      //
+    beginCommand(SRAM_READ_CODE,addr&addressMask());                          // Select chip, send READ & address //
+    while (done<length) {                                                     // Loop until all bytes compared    //
+      const uint16_t chunk = (length-done>SRAM_COPY_BYTES) ? SRAM_COPY_BYTES  // Limit to the buffer size         //
+                                                           : length-done;     //                                  //
+      _Transport.read(chunkBuffer,chunk);                                     // Read the next chunk              //
+      const uint16_t same = firstDifference(chunkBuffer,&bytePtr[done],       // Compare it with the buffer       //
+                                            chunk);                           //                                  //
+      done += same;                                                           //                                  //
+      if (same<chunk) break;                                                  // Stop at the first difference     //
+    } // of while there are bytes to be compared                              //                                  //
+    _Transport.deselect();                                                    // Pull the SS/CS high to deselect  //
+    return done;                                                              // Offset of first difference       //
+  } // of method compare                                                      //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method compareRegions compares "length" bytes of the memory starting at "addrA" with those starting at       **
+  ** "addrB" and returns the offset of the first byte which differs, or "length" if they are identical. As only   **
+  ** one region can be read at a time, each region is read in chunks of half of SRAM_COPY_BYTES bytes in turn.    **
+  ** Added v1.0.17.                                                                                               **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::compareRegions(           // Offset of the first difference   //
+    const uint32_t addrA,const uint32_t addrB,const uint32_t length) {        // of two regions, length if none   //
+    const uint16_t half = SRAM_COPY_BYTES/2;                                  // Each region uses half the buffer //
+    uint8_t chunkBuffer[SRAM_COPY_BYTES];                                     // Buffer for a chunk of each       //
+    uint32_t done = 0;                                                        // Bytes found to be identical      //
+    while (done<length) {                                                     // Loop until all bytes compared    //
+      const uint16_t chunk = (length-done>half) ? half : length-done;         // Limit to half the buffer size    //
+      beginCommand(SRAM_READ_CODE,(addrA+done)&addressMask());                // Read the next chunk of the first //
+      _Transport.read(chunkBuffer,chunk);                                     // region                           //
+      _Transport.deselect();                                                  //                                  //
+      beginCommand(SRAM_READ_CODE,(addrB+done)&addressMask());                // and of the second region         //
+      _Transport.read(&chunkBuffer[half],chunk);                              //                                  //
+      _Transport.deselect();                                                  //                                  //
+      const uint16_t same = firstDifference(chunkBuffer,&chunkBuffer[half],   // Compare the two chunks           //
+                                            chunk);                           //                                  //
+      done += same;                                                           //                                  //
+      if (same<chunk) break;                                                  // Stop at the first difference     //
+    } // of while there are bytes to be compared                              //                                  //
+    return done;                                                              // Offset of first difference       //
+  } // of method compareRegions                                               //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method checksum computes the CRC of "length" bytes of the memory starting at "addr", e.g. to check the data  **
+  ** kept by a battery backed 23LCV chip when powering up. The algorithm is SRAM_CRC16_CCITT, with polynomial     **
+  ** 0x1021, initial value 0xFFFF and no final XOR (also known as CRC-16/CCITT-FALSE), or SRAM_CRC32, the CRC-32  **
+  ** used by Ethernet and zip. The memory is read in one sequential READ in chunks of SRAM_COPY_BYTES bytes and   **
+  ** each chunk is added to the CRC using the table driven kernels in MicrochipSRAM.cpp. Any other algorithm      **
+  ** returns 0 without reading the memory. Added v1.0.18.                                                         **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::checksum(                 // CRC-16/CCITT or CRC-32 of a      //
+    const uint32_t addr,const uint32_t length,const uint8_t algorithm) {      // region of the memory             //
+    if (algorithm!=SRAM_CRC16_CCITT && algorithm!=SRAM_CRC32) return 0;       // Only two algorithms are known    //
+    uint32_t crc = (algorithm==SRAM_CRC32) ? 0xFFFFFFFF : 0xFFFF;             // Initial value of the CRC         //
+    uint8_t chunkBuffer[SRAM_COPY_BYTES];                                     // Buffer for one chunk             //
+    beginCommand(SRAM_READ_CODE,addr&addressMask());                          // Select chip, send READ & address //
+    for (uint32_t done=0;done<length;) {                                      // Loop until all bytes are read    //
+      const uint16_t chunk = (length-done>SRAM_COPY_BYTES) ? SRAM_COPY_BYTES  // Limit to the buffer size         //
+                                                           : length-done;     //                                  //
+      _Transport.read(chunkBuffer,chunk);                                     // Read the next chunk              //
+      if (algorithm==SRAM_CRC32)                                              // and add it to the CRC            //
+        crc = SRAMUpdateCRC32(crc,chunkBuffer,chunk);                         //                                  //
+      else crc = SRAMUpdateCRC16((uint16_t)crc,chunkBuffer,chunk);            //                                  //
+      done += chunk;                                                          //                                  //
+    } // of for-next each chunk                                               //                                  //
+    _Transport.deselect();                                                    // Pull the SS/CS high to deselect  //
+    return (algorithm==SRAM_CRC32) ? ~crc : crc;                              // CRC-32 is inverted at the end    //
+  } // of method checksum                                                     //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method find searches "length" bytes of the memory starting at "addr" for the first byte with the given       **
+  ** value, like memchr(), and returns its offset from "addr" or "length" if it isn't found. The memory is read   **
+  ** in one sequential READ in chunks of SRAM_COPY_BYTES bytes, which is stopped as soon as the value is found.   **
+  ** Added v1.0.19.                                                                                               **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::find(const uint32_t addr, // Offset of the first byte with a  //
+    const uint32_t length,const uint8_t value) {                              // value, length if none            //
+    uint8_t chunkBuffer[SRAM_COPY_BYTES];                                     // Buffer for one chunk             //
+    uint32_t done = 0;                                                        // Bytes searched so far            //
+    beginCommand(SRAM_READ_CODE,addr&addressMask());                          // Select chip, send READ & address //
+    while (done<length) {                                                     // Loop until all bytes searched    //
+      const uint16_t chunk = (length-done>SRAM_COPY_BYTES) ? SRAM_COPY_BYTES  // Limit to the buffer size         //
+                                                           : length-done;     //                                  //
+      _Transport.read(chunkBuffer,chunk);                                     // Read the next chunk              //
+      const uint8_t *found = (const uint8_t*)memchr(chunkBuffer,value,chunk); // and search it                    //
+      if (found!=NULL) {                                                      // Stop at the first byte found     //
+        done += found-chunkBuffer;                                            //                                  //
+        break;                                                                //                                  //
+      } // of if-then value found                                             //                                  //
+      done += chunk;                                                          //                                  //
+    } // of while there are bytes to be searched                              //                                  //
+    _Transport.deselect();                                                    // Pull the SS/CS high to deselect  //
+    return done;                                                              // Offset of the byte or length     //
+  } // of method find                                                         //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method find with a pattern searches "length" bytes of the memory starting at "addr" for the first copy of    **
+  ** the "patternLength" bytes of "pattern", like memmem(), and returns its offset from "addr" or "length" if it  **
+  ** isn't found. The Boyer-Moore-Horspool algorithm is used, which compares the last byte of the pattern first   **
+  ** and on a mismatch moves the pattern along by the distance found in a table of 256 bytes for the last byte of **
+  ** the window, so most bytes of the memory are only looked at once. The memory is read in one sequential READ   **
+  ** into a window of SRAM_COPY_BYTES bytes, and the bytes still needed are moved to the start of the window      **
+  ** before reading the next chunk, so every byte is only read once over the bus. Added v1.0.19.                  **
+  ** Patterns longer than the window, which is only possible when SRAM_COPY_BYTES is below 255 as on AVR, are     **
+  ** found by searching for their first SRAM_COPY_BYTES bytes and checking the rest of each match found with      **
+  ** compare(). This reads the memory more than once but gives the same result. The code is left out for larger  **
+  ** windows, where "patternLength" can never exceed SRAM_COPY_BYTES (v1.0.32).                                   **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::find(const uint32_t addr, // Offset of the first copy of a    //
+    const uint32_t length,const void *pattern,const uint8_t patternLength) {  // pattern, length if none          //
+    const uint8_t *patternPtr = (const uint8_t*)pattern;                      // Pointer to pattern beginning     //
+    if (patternLength==0) return 0;                                           // Empty pattern is always found    //
+    if (patternLength==1) return find(addr,length,patternPtr[0]);             // Single bytes are simpler         //
+    if (patternLength>length) return length;                                  // Pattern can't fit at all         //
+    #if SRAM_COPY_BYTES<255                                                   // Only a small window can be       //
+    if (patternLength>SRAM_COPY_BYTES) {                                      // shorter than the pattern, so find//
+      const uint8_t  head = (uint8_t)SRAM_COPY_BYTES;                         // the first part of the pattern    //
+      const uint8_t  rest = patternLength-head;                               // and then compare the rest        //
+      for (uint32_t offset=0;offset+patternLength<=length;offset++) {         // Loop over each match of the      //
+        const uint32_t range = length-offset-rest;                            // first part                       //
+        const uint32_t found = find(addr+offset,range,patternPtr,head);       //                                  //
+        if (found==range) break;                                              // No more matches                  //
+        offset += found;                                                      //                                  //
+        if (compare(addr+offset+head,patternPtr+head,rest)==rest)             // Rest is the same, so the whole   //
+          return offset;                                                      // pattern has been found           //
+      } // of for-next each match of the first part                           //                                  //
+      return length;                                                          // Pattern not found                //
+    } // of if-then pattern longer than the window                            //                                  //
+    #endif                                                                    // of if-then window below 255      //
+    uint8_t skip[256];                                                        // Distance to move the pattern for //
+    memset(skip,patternLength,sizeof(skip));                                  // each last byte in the window,    //
+    for (uint8_t i=0;i<patternLength-1;i++)                                   // which is the pattern length for  //
+      skip[patternPtr[i]] = patternLength-1-i;                                // bytes not in the pattern         //
+    uint8_t  window[SRAM_COPY_BYTES];                                         // Bytes read from the memory       //
+    uint32_t windowOffset = 0;                                                // Offset of window[0] from "addr"  //
+    uint16_t windowBytes  = 0;                                                // Bytes in the window              //
+    uint16_t position     = 0;                                                // Pattern position in the window   //
+    uint32_t result       = length;                                           // Not found until proven otherwise //
+    beginCommand(SRAM_READ_CODE,addr&addressMask());                          // Select chip, send READ & address //
+    while (true) {                                                            // Loop until found or end reached  //
+      if (position+patternLength>windowBytes) {                               // If the window is too short then  //
+        memmove(window,&window[position],windowBytes-position);               // drop the bytes that have been    //
+        windowOffset += position;                                             // passed, move the rest to the     //
+        windowBytes  -= position;                                             // start and fill it up again       //
+        position      = 0;                                                    //                                  //
+        uint32_t unread = length-windowOffset-windowBytes;                    // Bytes not read from the memory   //
+        if (unread<(uint32_t)(patternLength-windowBytes)) break;              // Pattern can no longer fit        //
+        uint16_t chunk = SRAM_COPY_BYTES-windowBytes;                         // Read as much as fits             //
+        if (chunk>unread) chunk = unread;                                     //                                  //
+        _Transport.read(&window[windowBytes],chunk);                          //                                  //
+        windowBytes += chunk;                                                 //                                  //
+      } // of if-then window too short                                        //                                  //
+      uint8_t i = patternLength-1;                                            // Compare from the last byte of    //
+      while (window[position+i]==patternPtr[i] && i>0) i--;                   // the pattern backwards            //
+      if (i==0 && window[position]==patternPtr[0]) {                          // If all bytes are the same then   //
+        result = windowOffset+position;                                       // the pattern has been found       //
+        break;                                                                //                                  //
+      } // of if-then pattern found                                           //                                  //
+      position += skip[window[position+patternLength-1]];                     // otherwise move the pattern on    //
+    } // of while not found and not at the end                                //                                  //
+    _Transport.deselect();                                                    // Pull the SS/CS high to deselect  //
+    return result;                                                            // Offset of the pattern or length  //
+  } // of method find                                                         //----------------------------------//
+  /*****************************************************************************************************************
+  ** Methods getv and putv read or write a list of "count" buffers in MCU memory, e.g. a header, payload and      **
+  ** trailer, like readv() and writev(). Given a start address, the buffers are transferred to or from adjacent   **
+  ** memory in one transaction, so the command and address are only sent once. Without a start address each       **
+  ** segment's "addr" is used and a new transaction is only started when a segment isn't adjacent to the previous **
+  ** one. The address following the last byte transferred is returned. Added v1.0.20.                             **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::getv(const uint32_t addr, // Read adjacent memory into a list //
+    const SRAMSegment *segments,const uint8_t count) {                        // of buffers in one transaction    //
+    return transferSegments(SRAM_READ_CODE,addr,segments,count,false);        //                                  //
+  } // of method getv                                                         //----------------------------------//
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::putv(const uint32_t addr, // Write a list of buffers to       //
+    const SRAMConstSegment *segments,const uint8_t count) {                   // adjacent memory in one transfer  //
+    return transferSegments(SRAM_WRITE_CODE,addr,segments,count,false);       //                                  //
+  } // of method putv                                                         //----------------------------------//
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::getv(                     // Read buffers from their own      //
+    const SRAMSegment *segments,const uint8_t count) {                        // addresses                        //
+    if (count==0) return 0;                                                   // Nothing to read                  //
+    return transferSegments(SRAM_READ_CODE,segments[0].addr,segments,count,   //                                  //
+                            true);                                            //                                  //
+  } // of method getv                                                         //----------------------------------//
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::putv(                     // Write buffers to their own       //
+    const SRAMConstSegment *segments,const uint8_t count) {                   // addresses                        //
+    if (count==0) return 0;                                                   // Nothing to write                 //
+    return transferSegments(SRAM_WRITE_CODE,segments[0].addr,segments,count,  //                                  //
+                            true);                                            //                                  //
+  } // of method putv                                                         //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method transferSegments reads or writes the list of segments starting at "addr". If "ownAddress" is set, a   **
+  ** segment whose address isn't the one following the previous segment ends the transaction and starts a new one **
+  ** at its own address. Added v1.0.20. The segments are SRAMSegment or SRAMConstSegment, and the overloads of    **
+  ** transferBuffer() pick read or write for each buffer, where a constant buffer can only be written (v1.0.33).  **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  template<class Segment>                                                     // Read or write a list of buffers  //
+  uint32_t MicrochipSRAMBase<Transport,CHIP_BYTES>::transferSegments(         // using as few transactions as     //
+    const uint8_t command,uint32_t addr,const Segment *segments,              //                                  //
+    const uint8_t count,const bool ownAddress) {                              // possible                         //
+    addr &= addressMask();                                                    // Wrap the start address           //
+    if (count==0) return addr;                                                // Nothing to transfer              //
+    beginCommand(command,addr);                                               // Select chip, send command & addr //
+    for (uint8_t i=0;i<count;i++) {                                           // Transfer each of the segments    //
+      if (ownAddress && (segments[i].addr&addressMask())!=addr) {             // If not adjacent then start a     //
+        _Transport.deselect();                                                // new transaction at the           //
+        addr = segments[i].addr&addressMask();                                // segment's address                //
+        beginCommand(command,addr);                                           //                                  //
+      } // of if-then segment not adjacent                                    //                                  //
+      transferBuffer(command,segments[i].buffer,segments[i].bytes);           // Read or write the whole buffer   //
+      addr = (addr+segments[i].bytes)&addressMask();                          // Address following the segment    //
+    } // of for-next each segment                                             //                                  //
+    _Transport.deselect();                                                    // Pull the SS/CS high to deselect  //
+    return addr;                                                              // Return the computed new address  //
+  } // of method transferSegments                                             //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method setMode writes the mode register to use sequential mode (SRAM_SEQ_MODE), which all methods except    **
+  ** getPage() and putPage() need. Page mode is only used inside those two and byte mode isn't used, so false is  **
+  ** returned for SRAM_PAGE_MODE, SRAM_BYTE_MODE or any other value, as the next read or write would silently    **
+  ** switch back to sequential mode anyway. Added v1.0.26, only sequential mode since v1.0.30.                    **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  bool MicrochipSRAMBase<Transport,CHIP_BYTES>::setMode(const uint8_t mode) { // Back to sequential mode          //
+    if (mode!=SRAM_SEQ_MODE) return false;                                    // Only sequential mode is public   //
+    writeMode(mode);                                                          // Write register if not in use     //
+    return true;                                                              //                                  //
+  } // of method setMode                                                      //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method writeMode writes "mode" to the mode register. The mode in use is cached, so the register is only      **
+  ** written when the mode changes, e.g. after getPage() or putPage() (v1.0.30).                                  **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  void MicrochipSRAMBase<Transport,CHIP_BYTES>::writeMode(                    // Write the mode register unless   //
+    const uint8_t mode) {                                                     // the mode is already in use       //
+    if (mode==_Mode) return;                                                  // Nothing to do if already in use  //
+    while (!asyncDone()) {}                                                   // Finish any async transfer first  //
+    _Transport.select();                                                      // Select by pulling CS pin low     //
+    _Transport.transfer(SRAM_WRITE_MODE_REG);                                 // Next byte writes mode register   //
+    _Transport.transfer(mode);                                                // Set the new mode                 //
+    _Transport.deselect();                                                    // Deselect by pulling CS pin high  //
+    _Mode = mode;                                                             // Remember the mode in use         //
+  } // of method writeMode                                                    //----------------------------------//
+  /*****************************************************************************************************************
+  ** Method getMode returns the mode in use, which is the cached value unless "readChip" is set. The mode         **
+  ** register is then read from the memory, e.g. to check that a battery backed 23LCV chip still holds its        **
+  ** settings, and the cached value is updated. In SDI and SQI mode the RDMR instruction is followed by a dummy   **
+  ** byte. Added v1.0.26.                                                                                         **
+  *****************************************************************************************************************/
+  template<class Transport, uint32_t CHIP_BYTES>                              //                                  //
+  uint8_t MicrochipSRAMBase<Transport,CHIP_BYTES>::getMode(                   // Mode in use, optionally read     //
+    const bool readChip) {                                                    // from the memory                  //
+    if (!readChip) return _Mode;                                              // Cached value                     //
+    while (!asyncDone()) {}                                                   // Finish any async transfer first  //
+    _Transport.select();                                                      // Select by pulling CS pin low     //
+    _Transport.transfer(SRAM_READ_MODE_REG);                                  // Next byte reads mode register    //
+    if (Transport::MAX_BUS_WIDTH>1 && _BusWidth!=SRAM_SPI_BUS)                // Dummy byte in SDI and SQI mode   //
+      _Transport.transfer(0x00);                                              //                                  //
+    uint8_t mode = 0;                                                         //                                  //
+    _Transport.read(&mode,1);                                                 // Read the register                //
+    _Transport.deselect();                                                    // Deselect by pulling CS pin high  //
+    _Mode = mode&(SRAM_PAGE_MODE|SRAM_SEQ_MODE);                              // Only the 2 mode bits are used    //
+    return _Mode;                                                             //                                  //
+  } // of method getMode                                                      //----------------------------------//
 #endif                                                                        //----------------------------------//
\ No newline at end of file
@@ -0,0 +1,56 @@
+/*******************************************************************************************************************
+** Host stand-in for the Arduino core functions declared in Arduino.h. The emulated time only advances when a     **
+** core or SPI function is called, which makes every benchmark run give the same result.                          **
+*******************************************************************************************************************/
+#include "Arduino.h"                                                          // Include the header definition    //
+#include "SRAMEmulator.h"                                                     // Chips selected by digitalWrite   //
+#include <stdio.h>                                                            // printf() for Serial output       //
+HostTiming hostTiming = { 3000, 500, 500, 125, 750, 8000000 };                // 16MHz ATmega328P defaults        //
+uint64_t   hostNanos  = 0;                                                    // Emulated time in nanoseconds     //
+HostSerial Serial;                                                            // The one Serial instance          //
+static uint8_t pinLevels[256];                                                // Last level written to each pin   //
+void pinMode(const uint8_t pin, const uint8_t mode) {                         // Pin modes don't matter here      //
+  (void)pin; (void)mode;                                                      //                                  //
+} // of function pinMode                                                      //----------------------------------//
+void digitalWrite(const uint8_t pin, const uint8_t value) {                   // Set a pin and tell the chips     //
+  hostNanos += hostTiming.digitalWriteNs;                                     // Charge the time of the call      //
+  pinLevels[pin] = value;                                                     // Store the level for reading      //
+  SRAMEmulator::pinWrite(pin,value);                                          // Select or deselect chips on pin  //
+} // of function digitalWrite                                                 //----------------------------------//
+int digitalRead(const uint8_t pin) { return pinLevels[pin]; }                 // Return the last level written    //
+unsigned long micros() { return (unsigned long)(hostNanos/1000); }            // Emulated time in microseconds    //
+unsigned long millis() { return (unsigned long)(hostNanos/1000000); }         // Emulated time in milliseconds    //
+void delay(const unsigned long ms) { hostNanos += (uint64_t)ms*1000000; }     // Delays just advance the time     //
+void delayMicroseconds(const unsigned int us) {                               //                                  //
+  hostNanos += (uint64_t)us*1000;                                             //                                  //
+} // of function delayMicroseconds                                            //----------------------------------//
+size_t HostSerial::print(const char *text) { return printf("%s",text); }      // Serial output goes to stdout     //
+size_t HostSerial::print(const char character) {                              //                                  //
+  return printf("%c",character);                                              //                                  //
+} // of method print                                                          //----------------------------------//
+size_t HostSerial::print(const int value, const int base) {                   // Signed values in decimal,        //
+  return print((long)value,base);                                             // unsigned in any base             //
+} // of method print                                                          //----------------------------------//
+size_t HostSerial::print(const unsigned int value, const int base) {          //                                  //
+  return print((unsigned long)value,base);                                    //                                  //
+} // of method print                                                          //----------------------------------//
+size_t HostSerial::print(const long value, const int base) {                  //                                  //
+  if (value<0 && base==10)                                                    // Negative decimals get a sign     //
+    return print('-')+print((unsigned long)-value,base);                      //                                  //
+  return print((unsigned long)value,base);                                    //                                  //
+} // of method print                                                          //----------------------------------//
+size_t HostSerial::print(const unsigned long value, const int base) {         //                                  //
+  char buffer[65];                                                            // Enough for 64 bits in binary     //
+  char *digit = &buffer[sizeof(buffer)-1];                                    // Digits are stored from the end   //
+  unsigned long number = value;                                               //                                  //
+  *digit = '\0';                                                              //                                  //
+  do {                                                                        // Store each digit, least          //
+    *--digit = "0123456789ABCDEF"[number%base];                               // significant first                //
+    number /= base;                                                           //                                  //
+  } while (number>0);                                                         //                                  //
+  return print(digit);                                                        //                                  //
+} // of method print                                                          //----------------------------------//
+size_t HostSerial::print(const double value, const int digits) {              // Floating point with the given    //
+  return printf("%.*f",digits,value);                                         // number of decimal digits         //
+} // of method print                                                          //----------------------------------//
+size_t HostSerial::println() { return print("\r\n"); }                        // Arduino ends lines with CR LF    //
@@ -0,0 +1,78 @@
+/*******************************************************************************************************************
+** Host stand-in for the Arduino core header. Together with the SPI.h stand-in and the SRAMEmulator class this    **
+** allows MicrochipSRAM.cpp, the templates in MicrochipSRAM.h and the example sketches to be compiled and run     **
+** unchanged on a Linux PC. Only the parts of the Arduino core used by the library and its examples are declared  **
+** here. The time returned by micros() and millis() is the emulated time, which is advanced by every call         **
+** according to the values in "hostTiming", so the example benchmarks report the speed expected on an Arduino     **
+** rather than that of the PC.                                                                                    **
+** See host_main.cpp for instructions on building a sketch for the host.                                          **
+*******************************************************************************************************************/
+#ifndef Arduino_h                                                             // Guard code definition            //
+  #define Arduino_h                                                           // Define the name inside guard code//
+  #include <stdint.h>                                                         // Fixed width integer types        //
+  #include <stddef.h>                                                         // size_t and NULL                  //
+  #include <string.h>                                                         // memcpy, memset and memcmp        //
+  #include <stdlib.h>                                                         // Standard library functions       //
+  #define HOST_EMULATOR                                                       // Denotes a host (PC) build        //
+  #define LOW            0                                                    // Pin levels                       //
+  #define HIGH           1                                                    //                                  //
+  #define INPUT          0                                                    // Pin modes                        //
+  #define OUTPUT         1                                                    //                                  //
+  #define INPUT_PULLUP   2                                                    //                                  //
+  #define LSBFIRST       0                                                    // SPI bit orders                   //
+  #define MSBFIRST       1                                                    //                                  //
+  #define B00000000      0x00                                                 // Binary constants used by the     //
+  #define B01000000      0x40                                                 // library                          //
+  #define B10000000      0x80                                                 //                                  //
+  #define B11000000      0xC0                                                 //                                  //
+  #define A0             14                                                   // Analog pins of an Arduino Uno    //
+  #define A1             15                                                   //                                  //
+  #define A2             16                                                   //                                  //
+  #define A3             17                                                   //                                  //
+  #define A4             18                                                   //                                  //
+  #define A5             19                                                   //                                  //
+  typedef bool     boolean;                                                   // Arduino data types               //
+  typedef uint8_t  byte;                                                      //                                  //
+  /*****************************************************************************************************************
+  ** The emulated time in nanoseconds charged for each core call, the defaults are those of a 16MHz ATmega328P.   **
+  ** The values may be changed by a sketch to model other processors.                                             **
+  *****************************************************************************************************************/
+  struct HostTiming {                                                         // Emulated cost of core calls      //
+    uint32_t digitalWriteNs;                                                  // One digitalWrite() call          //
+    uint32_t transferCallNs;                                                  // One SPI.transfer(byte) call      //
+    uint32_t blockCallNs;                                                     // One SPI.transfer(buffer) call    //
+    uint32_t blockByteNs;                                                     // Each byte in a buffer transfer   //
+    uint32_t transactionNs;                                                   // begin/endTransaction() call      //
+    uint32_t maxSPIClock;                                                     // Fastest possible SPI clock in Hz //
+  }; // of struct HostTiming                                                  //----------------------------------//
+  extern HostTiming hostTiming;                                               // Timing used by the stand-ins     //
+  extern uint64_t   hostNanos;                                                // Emulated time in nanoseconds     //
+  void          pinMode(const uint8_t pin, const uint8_t mode);               // Pin functions                    //
+  void          digitalWrite(const uint8_t pin, const uint8_t value);         //                                  //
+  int           digitalRead(const uint8_t pin);                               //                                  //
+  unsigned long micros();                                                     // Time functions                   //
+  unsigned long millis();                                                     //                                  //
+  void          delay(const unsigned long ms);                                //                                  //
+  void          delayMicroseconds(const unsigned int us);                     //                                  //
+  /*****************************************************************************************************************
+  ** Serial writes everything to the standard output of the PC                                                    **
+  *****************************************************************************************************************/
+  class HostSerial {                                                          // Stand-in for Serial              //
+    public:                                                                   // Publicly visible methods         //
+      void   begin(const unsigned long baud) { (void)baud; }                  // Nothing to initialize            //
+      operator bool() { return true; }                                        // Serial is always ready           //
+      size_t print(const char *text);                                         // Print methods for each of the    //
+      size_t print(const char character);                                     // data types used by sketches      //
+      size_t print(const int value, const int base = 10);                     //                                  //
+      size_t print(const unsigned int value, const int base = 10);            //                                  //
+      size_t print(const long value, const int base = 10);                    //                                  //
+      size_t print(const unsigned long value, const int base = 10);           //                                  //
+      size_t print(const double value, const int digits = 2);                 //                                  //
+      size_t println();                                                       //                                  //
+      template< typename T > size_t println(const T &value) {                 // println() of any printable type  //
+        size_t bytes = print(value);                                          // is print() plus a new line       //
+        return bytes + println();                                             //                                  //
+      } // of method println                                                  //----------------------------------//
+  }; // of class HostSerial                                                   //                                  //
+  extern HostSerial Serial;                                                   // The one Serial instance          //
+#endif                                                                        //----------------------------------//
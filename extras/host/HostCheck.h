@@ -0,0 +1,19 @@
+/*******************************************************************************************************************
+** Checks made by the host test sketches in extras/host. hostCheck() shows "FAIL" and the title of any check      **
+** which isn't "ok" and counts it in "hostFailures", so that host_main.cpp returns an error when the sketch has   **
+** found a problem and a test script doesn't have to search the output. The result is returned, so a sketch can   **
+** show more details of a failed check.                                                                           **
+*******************************************************************************************************************/
+#ifndef HostCheck_h                                                           // Guard code definition            //
+  #define HostCheck_h                                                         // Define the name inside guard code//
+  #include "Arduino.h"                                                        // Host stand-in for Serial         //
+  extern uint32_t hostFailures;                                               // Failed checks, see host_main.cpp //
+  inline bool hostCheck(const bool ok,const char *title) {                    // Show and count a failed check    //
+    if (!ok) {                                                                //                                  //
+      Serial.print("FAIL ");                                                  //                                  //
+      Serial.println(title);                                                  //                                  //
+      hostFailures++;                                                         //                                  //
+    } // of if-then check failed                                              //                                  //
+    return ok;                                                                // Return the result                //
+  } // of function hostCheck                                                  //----------------------------------//
+#endif                                                                        //----------------------------------//
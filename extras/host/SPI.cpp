@@ -0,0 +1,42 @@
+/*******************************************************************************************************************
+** Host stand-in for the SPI library methods declared in SPI.h. The time of each transfer is the call overhead    **
+** from "hostTiming" plus 8 SPI clock cycles per byte, or 4 or 2 when using 2 or 4 data lines, where the clock is **
+** that of the current transaction limited to the fastest clock the emulated processor can generate, just like    **
+** the real SPI library does.                                                                                     **
+*******************************************************************************************************************/
+#include "SPI.h"                                                              // Include the header definition    //
+#include "SRAMEmulator.h"                                                     // Chips the bytes are clocked to   //
+SPIClass SPI;                                                                 // The one hardware SPI instance    //
+void SPIClass::beginTransaction(const SPISettings settings) {                 // Use settings until the end       //
+  hostNanos += hostTiming.transactionNs;                                      // Charge the time of the call      //
+  _Settings  = settings;                                                      // Store the settings               //
+} // of method beginTransaction                                               //----------------------------------//
+void SPIClass::endTransaction() {                                             // Return to the default settings   //
+  hostNanos += hostTiming.transactionNs;                                      // Charge the time of the call      //
+  _Settings  = SPISettings();                                                 // Back to the default settings     //
+} // of method endTransaction                                                 //----------------------------------//
+uint32_t SPIClass::clock() const {                                            // SPI clock speed in use in Hz     //
+  return _Settings.clock<hostTiming.maxSPIClock ? _Settings.clock             // Limited to the fastest clock     //
+                                                : hostTiming.maxSPIClock;     // the processor can generate       //
+} // of method clock                                                          //----------------------------------//
+uint8_t SPIClass::clockByte(const uint8_t data) {                             // Clock one byte on the bus        //
+  hostNanos += 8000000000ULL/_DataLines/clock();                              // Time of the 8, 4 or 2 clock      //
+  return SRAMEmulator::busTransfer(data,_DataLines);                          // cycles and the byte read         //
+} // of method clockByte                                                      //----------------------------------//
+uint8_t SPIClass::transfer(const uint8_t data) {                              // Send and receive one byte        //
+  hostNanos += hostTiming.transferCallNs;                                     // Charge the time of the call      //
+  return clockByte(data);                                                     // and clock the byte               //
+} // of method transfer                                                       //----------------------------------//
+uint16_t SPIClass::transfer16(const uint16_t data) {                          // Send and receive two bytes       //
+  hostNanos += hostTiming.transferCallNs;                                     // Charge the time of the call      //
+  uint16_t result = clockByte(data>>8)<<8;                                    // MSB is sent first                //
+  return result | clockByte(data&0xFF);                                       //                                  //
+} // of method transfer16                                                     //----------------------------------//
+void SPIClass::transfer(void *buffer, size_t count) {                         // Send & receive buffer in place   //
+  uint8_t *bytePtr = (uint8_t*)buffer;                                        // Pointer to buffer beginning      //
+  hostNanos += hostTiming.blockCallNs;                                        // Charge the time of the call      //
+  for (size_t i=0;i<count;i++) {                                              // Each byte is clocked out and     //
+    hostNanos += hostTiming.blockByteNs;                                      // replaced with the byte read      //
+    bytePtr[i] = clockByte(bytePtr[i]);                                       //                                  //
+  } // of for-next each byte                                                  //                                  //
+} // of method transfer                                                       //----------------------------------//
@@ -0,0 +1,42 @@
+/*******************************************************************************************************************
+** Host stand-in for the Arduino SPI library. Each byte transferred is clocked into every SRAMEmulator whose      **
+** CS/SS pin is currently low, and the emulated time is advanced by the 8 clock cycles at the SPI clock speed of  **
+** the current transaction plus the call overhead set in "hostTiming".                                            **
+** setDataLines() isn't part of the Arduino SPI library. It models a dual or quad SPI peripheral, such as the     **
+** RP2040 PIO or ESP32 QSPI, which clocks each byte over 2 or 4 data lines in 4 or 2 cycles.                      **
+*******************************************************************************************************************/
+#ifndef SPI_h                                                                 // Guard code definition            //
+  #define SPI_h                                                               // Define the name inside guard code//
+  #include "Arduino.h"                                                        // Arduino data type definitions    //
+  #define SPI_MODE0 0x00                                                      // SPI clock polarity and phase     //
+  #define SPI_MODE1 0x04                                                      //                                  //
+  #define SPI_MODE2 0x08                                                      //                                  //
+  #define SPI_MODE3 0x0C                                                      //                                  //
+  class SPISettings {                                                         // Settings of one transaction      //
+    public:                                                                   // Publicly visible members         //
+      SPISettings() : SPISettings(4000000,MSBFIRST,SPI_MODE0) {}              // Arduino default settings         //
+      SPISettings(const uint32_t clockSpeed, const uint8_t order,             // Settings given by the caller     //
+                  const uint8_t mode)                                         //                                  //
+        : clock(clockSpeed), bitOrder(order), dataMode(mode) {}               //                                  //
+      uint32_t clock;                                                         // SPI clock speed in Hz            //
+      uint8_t  bitOrder;                                                      // MSBFIRST or LSBFIRST             //
+      uint8_t  dataMode;                                                      // SPI_MODE0 to SPI_MODE3           //
+  }; // of class SPISettings                                                  //----------------------------------//
+  class SPIClass {                                                            // Stand-in for the SPI library     //
+    public:                                                                   // Publicly visible methods         //
+      void     begin() {}                                                     // Nothing to initialize            //
+      void     end() {}                                                       //                                  //
+      void     beginTransaction(const SPISettings settings);                  // Use settings until the end       //
+      void     endTransaction();                                              // Return to the default settings   //
+      uint8_t  transfer(const uint8_t data);                                  // Send and receive one byte        //
+      uint16_t transfer16(const uint16_t data);                               // Send and receive two bytes       //
+      void     transfer(void *buffer, size_t count);                          // Send & receive buffer in place   //
+      uint32_t clock() const;                                                 // SPI clock speed in use in Hz     //
+      void     setDataLines(const uint8_t lines) { _DataLines = lines; }      // Host only, 1, 2 or 4 data lines  //
+    private:                                                                  // Private variables and methods    //
+      uint8_t  clockByte(const uint8_t data);                                 // Clock one byte on the bus        //
+      SPISettings _Settings;                                                  // Settings of transaction          //
+      uint8_t  _DataLines = 1;                                                // Data lines used for each byte    //
+  }; // of class SPIClass                                                     //----------------------------------//
+  extern SPIClass SPI;                                                        // The one hardware SPI instance    //
+#endif                                                                        //----------------------------------//
@@ -0,0 +1,187 @@
+/*******************************************************************************************************************
+** SRAMEmulator class method definitions, see SRAMEmulator.h for a description of the model. The instruction      **
+** codes and mode register bits are taken from the chip datasheets rather than from MicrochipSRAM.h, so that the  **
+** library is checked against the chips and not against itself.                                                   **
+*******************************************************************************************************************/
+#include "SRAMEmulator.h"                                                     // Include the header definition    //
+const uint8_t  EMULATOR_READ  = 0x03;                                         // Read data from memory            //
+const uint8_t  EMULATOR_WRITE = 0x02;                                         // Write data to memory             //
+const uint8_t  EMULATOR_RDMR  = 0x05;                                         // Read mode register               //
+const uint8_t  EMULATOR_WRMR  = 0x01;                                         // Write mode register              //
+const uint8_t  EMULATOR_EDIO  = 0x3B;                                         // Enter dual I/O access            //
+const uint8_t  EMULATOR_EQIO  = 0x38;                                         // Enter quad I/O access            //
+const uint8_t  EMULATOR_RSTIO = 0xFF;                                         // Reset dual and quad I/O access   //
+const uint8_t  MODE_MASK      = 0xC0;                                         // Bits 7 & 6 hold the mode         //
+const uint8_t  MODE_BYTE      = 0x00;                                         // 00 is byte mode                  //
+const uint8_t  MODE_PAGE      = 0x80;                                         // 10 is page mode                  //
+const uint8_t  MODE_SEQUENTIAL= 0x40;                                         // 01 is sequential mode            //
+const uint8_t  MODE_RESERVED  = 0xC0;                                         // 11 is reserved                   //
+const uint8_t  BUS_IDLE       = 0xFF;                                         // SO is high-Z, pulled up          //
+static SRAMEmulator *emulators[SRAM_EMULATOR_MAX];                            // Chips on the bus, zero at start  //
+/*******************************************************************************************************************
+** Class Constructor allocates and clears the memory and attaches the chip to the CS/SS pin. As the emulators are **
+** usually declared globally, just like the MicrochipSRAM instances used by a sketch, the list of chips is a      **
+** plain array which is zero before any constructor runs.                                                         **
+*******************************************************************************************************************/
+SRAMEmulator::SRAMEmulator(const uint32_t chipBytes, const uint8_t SSPin)     // CONSTRUCTOR - Instantiate class  //
+  : bytes(chipBytes), addressBytes(chipBytes>65536 ? 3 : 2), SSPin(SSPin) {   // 1Mbit chips use 3 address bytes  //
+  _Memory = new uint8_t[bytes];                                               // Allocate the memory              //
+  memset(_Memory,0,bytes);                                                    // and clear it                     //
+  _Mode = (bytes>32768) ? MODE_SEQUENTIAL : MODE_BYTE;                        // Power-on mode of the chip        //
+  for (uint8_t i=0;i<SRAM_EMULATOR_MAX;i++) {                                 // Add the chip to the first free   //
+    if (emulators[i]==NULL) {                                                 // entry of the list of chips on    //
+      emulators[i] = this;                                                    // the bus                          //
+      break;                                                                  //                                  //
+    } // of if-then entry is free                                             //                                  //
+  } // of for-next each list entry                                            //                                  //
+} // of class constructor                                                     //----------------------------------//
+/*******************************************************************************************************************
+** Class Destructor removes the chip from the bus and frees the memory                                            **
+*******************************************************************************************************************/
+SRAMEmulator::~SRAMEmulator() {                                               // DESTRUCTOR                       //
+  for (uint8_t i=0;i<SRAM_EMULATOR_MAX;i++)                                   // Remove chip from the list        //
+    if (emulators[i]==this) emulators[i] = NULL;                              //                                  //
+  delete[] _Memory;                                                           // Free the memory                  //
+} // of class destructor                                                      //----------------------------------//
+/*******************************************************************************************************************
+** Method select is called when the CS/SS pin goes low and starts decoding a new instruction                      **
+*******************************************************************************************************************/
+void SRAMEmulator::select() {                                                 // CS/SS pin has been pulled low    //
+  if (_Selected) return;                                                      // Ignore if already low            //
+  _Selected     = true;                                                       // Chip is now selected             //
+  _State        = COMMAND;                                                    // First byte is the instruction    //
+  _AddressCount = 0;                                                          // No address bytes received yet    //
+  _Address      = 0;                                                          //                                  //
+  _DataCount    = 0;                                                          // No data bytes transferred yet    //
+  _OnesBits     = 0;                                                          // No RSTIO bits on unused lines yet//
+  transactions++;                                                             // Count the transaction            //
+} // of method select                                                         //----------------------------------//
+/*******************************************************************************************************************
+** Method deselect is called when the CS/SS pin goes high. An instruction stopped before all address bytes were   **
+** sent is counted as a protocol error.                                                                           **
+*******************************************************************************************************************/
+void SRAMEmulator::deselect() {                                               // CS/SS pin has been pulled high   //
+  if (!_Selected) return;                                                     // Ignore if already high           //
+  if (_State==ADDRESS || _State==DUMMY) protocolErrors++;                     // Incomplete address is an error   //
+  _Selected = false;                                                          // Chip is no longer selected       //
+  _BusWidth = _NextBusWidth;                                                  // EDIO, EQIO & RSTIO apply now     //
+} // of method deselect                                                       //----------------------------------//
+/*******************************************************************************************************************
+** Method advanceAddress moves to the next address after a data byte, depending upon the mode. In page mode the   **
+** address wraps around within the 32 byte page and in sequential mode at the end of the memory. In byte mode     **
+** only one byte is transferred per instruction, so the address doesn't change and clock() ignores further data   **
+** bytes.                                                                                                         **
+*******************************************************************************************************************/
+void SRAMEmulator::advanceAddress() {                                         // Next address for current mode    //
+  if (_Mode==MODE_PAGE)                                                       // Page mode wraps in the page      //
+    _Address = (_Address&~(uint32_t)(SRAM_EMULATOR_PAGE-1)) |                 //                                  //
+               ((_Address+1)&(SRAM_EMULATOR_PAGE-1));                         //                                  //
+  else if (_Mode==MODE_SEQUENTIAL)                                            // Sequential mode wraps at the end //
+    _Address = (_Address+1)&(bytes-1);                                        // of memory                        //
+} // of method advanceAddress                                                 //----------------------------------//
+/*******************************************************************************************************************
+** Method clock transfers one byte while the chip is selected. The byte sent by the master is decoded according   **
+** to the current state and the byte returned is what the chip drives on its SO line, which is high-Z (read as    **
+** 0xFF) except while returning data or the mode register. In SDI and SQI mode the byte is clocked over 2 or 4    **
+** lines and takes 4 or 2 clock cycles. When RSTIO is sent on more lines than the chip uses, all of them are high **
+** so the chip reads ones on its own lines and decodes RSTIO once 8 bits have arrived.                            **
+*******************************************************************************************************************/
+uint8_t SRAMEmulator::clock(const uint8_t dataIn, const uint8_t lines) {      // Clock one byte in and out        //
+  uint8_t dataOut = BUS_IDLE;                                                 // SO is high-Z by default          //
+  bytesClocked++;                                                             // Count the byte and its clock     //
+  clockCycles += 8/lines;                                                     // cycles on the lines used         //
+  if (_State==COMMAND && lines>_BusWidth && dataIn==EMULATOR_RSTIO) {         // Lines held high that the chip    //
+    _OnesBits += 8/lines*_BusWidth;                                           // doesn't use don't matter, so it  //
+    if (_OnesBits>=8) {                                                       // reads RSTIO once it has clocked  //
+      _NextBusWidth = 1;                                                      // in 8 bits                        //
+      _State        = IGNORE;                                                 //                                  //
+    } // of if-then RSTIO complete                                            //                                  //
+    return dataOut;                                                           //                                  //
+  } // of if-then RSTIO on more lines                                         //                                  //
+  if (lines!=_BusWidth && _State!=IGNORE) {                                   // The chip can't decode bytes sent //
+    protocolErrors++;                                                         // on the wrong number of lines,    //
+    _State = IGNORE;                                                          // so ignore the transaction        //
+  } // of if-then wrong number of lines                                       //                                  //
+  switch (_State) {                                                           // Action depends upon the state    //
+    case COMMAND:                                                             // First byte is the instruction    //
+      _Command = dataIn;                                                      // Store the instruction            //
+      if (dataIn==EMULATOR_READ || dataIn==EMULATOR_WRITE) _State = ADDRESS;  // Read and write need an address   //
+      else if (dataIn==EMULATOR_WRMR) _State = MODE_WRITE;                    // Next byte is the new mode        //
+      else if (dataIn==EMULATOR_RDMR)                                         // Next bytes return the mode, after//
+        _State = (_BusWidth==1) ? MODE_READ : DUMMY;                          // a dummy byte in SDI and SQI      //
+      else if (dataIn==EMULATOR_RSTIO) {                                      // RSTIO returns to SPI mode, and   //
+        _NextBusWidth = 1;                                                    // every chip ignores it in SPI mode//
+        _State        = IGNORE;                                               // Instruction is complete          //
+      } else if (bytes>32768 &&                                               // The 23x512 and 23x1024 can       //
+                 (dataIn==EMULATOR_EDIO || dataIn==EMULATOR_EQIO)) {          // switch the number of data lines  //
+        if (_BusWidth==1)                                                     // once CS/SS goes high again, but  //
+          _NextBusWidth = (dataIn==EMULATOR_EDIO) ? 2 : 4;                    // only from SPI mode               //
+        else protocolErrors++;                                                //                                  //
+        _State = IGNORE;                                                      //                                  //
+      } else {                                                                // Anything else isn't supported    //
+        protocolErrors++;                                                     // so count the error and ignore    //
+        _State = IGNORE;                                                      // the rest of the transaction      //
+      } // of if-then-else instruction type                                   //                                  //
+      break;                                                                  //                                  //
+    case ADDRESS:                                                             // Address bytes, MSB first         //
+      _Address = (_Address<<8) | dataIn;                                      // Add the byte to the address      //
+      if (++_AddressCount==addressBytes) {                                    // If the address is complete       //
+        _Address &= bytes-1;                                                  // unused upper bits are ignored    //
+        _State    = (_Command==EMULATOR_READ && _BusWidth!=1) ? DUMMY : DATA; // data comes next, after a dummy   //
+      } // of if-then address complete                                        // byte for SDI and SQI reads       //
+      break;                                                                  //                                  //
+    case DUMMY:                                                               // Bus turns around, then the data  //
+      _State = (_Command==EMULATOR_RDMR) ? MODE_READ : DATA;                  // or mode register is returned     //
+      break;                                                                  //                                  //
+    case DATA:                                                                // Data bytes read or written       //
+      if (_Mode==MODE_BYTE && _DataCount>0) break;                            // Byte mode is one byte only       //
+      if (_Command==EMULATOR_READ) dataOut = _Memory[_Address];               // Return the byte read or          //
+                              else _Memory[_Address] = dataIn;                // store the byte written           //
+      dataBytes++;                                                            // Count the data bytes             //
+      _DataCount++;                                                           //                                  //
+      advanceAddress();                                                       // Move to the next address         //
+      break;                                                                  //                                  //
+    case MODE_WRITE:                                                          // New mode register value          //
+      if ((dataIn&MODE_MASK)==MODE_RESERVED) protocolErrors++;                // Reserved mode isn't accepted     //
+                                        else _Mode = dataIn&MODE_MASK;        // otherwise set the new mode       //
+      _State = IGNORE;                                                        // Instruction is complete          //
+      break;                                                                  //                                  //
+    case MODE_READ:                                                           // Mode register is returned        //
+      dataOut = _Mode;                                                        // for each byte clocked            //
+      break;                                                                  //                                  //
+    case IGNORE:                                                              // Anything after a complete or     //
+      break;                                                                  // invalid instruction is ignored   //
+  } // of switch the decoding state                                           //                                  //
+  return dataOut;                                                             // Return byte driven on SO         //
+} // of method clock                                                          //----------------------------------//
+/*******************************************************************************************************************
+** Method resetCounters sets all of the statistics counters back to zero, e.g. before measuring one library call  **
+*******************************************************************************************************************/
+void SRAMEmulator::resetCounters() {                                          // Set all counters to zero         //
+  transactions = bytesClocked = dataBytes = clockCycles = protocolErrors = 0; //                                  //
+} // of method resetCounters                                                  //----------------------------------//
+/*******************************************************************************************************************
+** Static method pinWrite is called by the digitalWrite() stand-in and selects or deselects any chip attached to  **
+** pin                                                                                                            **
+*******************************************************************************************************************/
+void SRAMEmulator::pinWrite(const uint8_t pin, const uint8_t value) {         // Called by digitalWrite()         //
+  for (uint8_t i=0;i<SRAM_EMULATOR_MAX;i++) {                                 // Check each chip on the bus       //
+    if (emulators[i]!=NULL && emulators[i]->SSPin==pin) {                     // If attached to the pin then      //
+      if (value==LOW) emulators[i]->select();                                 // low selects the chip and         //
+                 else emulators[i]->deselect();                               // high deselects it                //
+    } // of if-then chip attached to pin                                      //                                  //
+  } // of for-next each chip                                                  //                                  //
+} // of method pinWrite                                                       //----------------------------------//
+/*******************************************************************************************************************
+** Static method busTransfer is called by the SPI stand-in and clocks a byte into every selected chip. The SO     **
+** lines of the chips are open while not driven, so the byte returned is the AND of the bytes returned by all     **
+** chips.                                                                                                         **
+*******************************************************************************************************************/
+uint8_t SRAMEmulator::busTransfer(const uint8_t dataIn,                       // Clock a byte into all selected   //
+                                  const uint8_t lines) {                      // chips using 1, 2 or 4 lines      //
+  uint8_t dataOut = BUS_IDLE;                                                 // Pulled up when nothing drives    //
+  for (uint8_t i=0;i<SRAM_EMULATOR_MAX;i++)                                   // Clock the byte into each of the  //
+    if (emulators[i]!=NULL && emulators[i]->_Selected)                        // selected chips                   //
+      dataOut &= emulators[i]->clock(dataIn,lines);                           //                                  //
+  return dataOut;                                                             // Return the byte read             //
+} // of method busTransfer                                                    //----------------------------------//
@@ -0,0 +1,57 @@
+/*******************************************************************************************************************
+** Class definition header for the SRAMEmulator class, a software model of the Microchip 23x640, 23x256, 23x512,  **
+** 23x1024, 23LCV512 and 23LCV1024 serial SRAM chips used to run and test the MicrochipSRAM library on a PC.      **
+** Each instance is attached to a CS/SS pin. While that pin is held low by digitalWrite(), every byte sent using  **
+** the SPI stand-in is clocked into the model, which decodes the READ, WRITE, RDMR and WRMR instructions using 2  **
+** address bytes for chips up to 512kbit and 3 for the 1Mbit chips. The mode register selects byte, page or       **
+** sequential mode, with page mode wrapping at the 32 byte page boundary and sequential mode wrapping at the end  **
+** of memory just as the real chips do. The power-on mode is byte mode for the 23x640 and 23x256 and sequential   **
+** mode for the larger chips.                                                                                     **
+** Every byte clocked is counted, as are the SPI clock cycles, transactions and data bytes, so that the number of **
+** bus operations a library method needs can be checked and compared. Anything a real chip would not accept, such **
+** as an unknown instruction or the reserved mode register value, is counted in "protocolErrors".                 **
+*******************************************************************************************************************/
+#ifndef SRAMEmulator_h                                                        // Guard code definition            //
+  #define SRAMEmulator_h                                                      // Define the name inside guard code//
+  #include "Arduino.h"                                                        // Arduino data type definitions    //
+  const uint8_t  SRAM_EMULATOR_MAX  = 4;                                      // Maximum number of chips on bus   //
+  const uint8_t  SRAM_EMULATOR_PAGE = 32;                                     // Bytes in one page of the chips   //
+  class SRAMEmulator {                                                        // Class definition                 //
+    public:                                                                   // Publicly visible methods         //
+      SRAMEmulator(const uint32_t chipBytes, const uint8_t SSPin);            // Class constructor                //
+      ~SRAMEmulator();                                                        // Class destructor                 //
+      void     select();                                                      // CS/SS pin has been pulled low    //
+      void     deselect();                                                    // CS/SS pin has been pulled high   //
+      uint8_t  clock(const uint8_t dataIn, const uint8_t lines = 1);          // Clock one byte in and out        //
+      uint8_t  busWidth() const { return _BusWidth; }                         // Data lines used, 1, 2 or 4       //
+      uint8_t  mode() const { return _Mode; }                                 // Current mode register value      //
+      uint8_t *memory()     { return _Memory; }                               // Memory contents for checking     //
+      void     resetCounters();                                               // Set all counters to zero         //
+      static void    pinWrite(const uint8_t pin, const uint8_t value);        // Called by digitalWrite()         //
+      static uint8_t busTransfer(const uint8_t dataIn,                        // Clock a byte into all selected   //
+                                 const uint8_t lines = 1);                    // chips using 1, 2 or 4 lines      //
+      const uint32_t bytes;                                                   // Number of bytes on the chip      //
+      const uint8_t  addressBytes;                                            // Number of address bytes          //
+      const uint8_t  SSPin;                                                   // CS/SS pin of the chip            //
+      uint32_t transactions   = 0;                                            // Times the chip was selected      //
+      uint32_t bytesClocked   = 0;                                            // All bytes clocked while selected //
+      uint32_t dataBytes      = 0;                                            // Bytes read from or written to    //
+      uint32_t clockCycles    = 0;                                            // SPI clock cycles while selected  //
+      uint32_t protocolErrors = 0;                                            // Invalid commands or values       //
+    private:                                                                  // Private variables and methods    //
+      enum State { COMMAND, ADDRESS, DUMMY, DATA, MODE_WRITE, MODE_READ,      // Decoding state of instruction    //
+                   IGNORE };                                                  //                                  //
+      void     advanceAddress();                                              // Next address for current mode    //
+      uint8_t *_Memory;                                                       // Contents of the memory           //
+      uint8_t  _Mode;                                                         // Mode register                    //
+      uint8_t  _BusWidth = 1;                                                 // SPI, SDI or SQI data lines       //
+      uint8_t  _NextBusWidth = 1;                                             // Used once CS/SS goes high        //
+      bool     _Selected = false;                                             // Set while CS/SS is low           //
+      State    _State    = COMMAND;                                           // Decoding state                   //
+      uint8_t  _Command  = 0;                                                 // Current instruction              //
+      uint8_t  _AddressCount = 0;                                             // Address bytes received so far    //
+      uint32_t _Address  = 0;                                                 // Current memory address           //
+      uint32_t _DataCount = 0;                                                // Data bytes in this instruction   //
+      uint8_t  _OnesBits  = 0;                                                // RSTIO bits sent on more lines    //
+  }; // of SRAMEmulator class definition                                      //                                  //
+#endif                                                                        //----------------------------------//
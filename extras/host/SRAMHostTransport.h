@@ -0,0 +1,30 @@
+/*******************************************************************************************************************
+** Transport class for running the MicrochipSRAM library on the host with SDI (dual I/O) and SQI (quad I/O)       **
+** access. It is the SRAMHardwareSPI transport with the number of data lines passed to the SPI stand-in's         **
+** setDataLines() while the memory is selected, in the way that a transport for a dual or quad SPI peripheral,    **
+** such as the RP2040 PIO or ESP32 QSPI, would switch its peripheral. It is used by declaring e.g.                **
+** MicrochipSRAMBase<SRAMHostMultiIO> memory(SRAMHostMultiIO(A5));                                                **
+** and then calling memory.setBusMode(SRAM_SQI_BUS).                                                              **
+*******************************************************************************************************************/
+#ifndef SRAMHostTransport_h                                                   // Guard code definition            //
+  #define SRAMHostTransport_h                                                 // Define the name inside guard code//
+  #include <MicrochipSRAM.h>                                                  // Library the transport is for     //
+  class SRAMHostMultiIO : public SRAMHardwareSPI {                            // Transport with 1, 2 or 4 lines   //
+    public:                                                                   // Publicly visible methods         //
+      static const uint8_t MAX_BUS_WIDTH = SRAM_SQI_BUS;                      // Supports up to 4 data lines      //
+      SRAMHostMultiIO(const uint8_t SSPin,                                    // Class constructor                //
+                      const uint32_t clockSpeed = SRAM_SPI_CLOCK)             // Optional SPI clock speed in Hz   //
+        : SRAMHardwareSPI(SSPin,clockSpeed) {}                                //                                  //
+      void select() {                                                         // Select the memory, then use the  //
+        SRAMHardwareSPI::select();                                            // current number of data lines     //
+        SPI.setDataLines(_BusWidth);                                          //                                  //
+      } // of method select                                                   //----------------------------------//
+      void deselect() {                                                       // Deselect the memory, then go back//
+        SRAMHardwareSPI::deselect();                                          // to one data line for any other   //
+        SPI.setDataLines(SRAM_SPI_BUS);                                       // devices on the bus               //
+      } // of method deselect                                                 //----------------------------------//
+      void setBusWidth(const uint8_t lines) { _BusWidth = lines; }            // Used from the next select()      //
+    private:                                                                  // Private variables and methods    //
+      uint8_t _BusWidth = SRAM_SPI_BUS;                                       // Data lines used when selected    //
+  }; // of SRAMHostMultiIO class definition                                   //                                  //
+#endif                                                                        //----------------------------------//
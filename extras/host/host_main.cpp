@@ -0,0 +1,66 @@
+/*******************************************************************************************************************
+** Runs an Arduino sketch on a Linux PC using the host stand-ins for the Arduino core and SPI library and one or  **
+** two emulated memory chips. The sketch file is given in SKETCH, the chip size in bytes in HOST_SRAM_BYTES       **
+** (default 1Mbit) and its CS/SS pin in HOST_SRAM_PIN (default A5, as used by the examples). A second chip is     **
+** emulated if HOST_SRAM2_PIN is defined, with its size in HOST_SRAM2_BYTES. From the library's root directory a  **
+** sketch is built and run with:                                                                                  **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"Examples/sram_benchmark/sram_benchmark.ino"'        **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+** The "-fpermissive" flag is the one used by the Arduino IDE. The sketch's setup() is called once, followed by   **
+** loop() HOST_LOOPS times (default 0, as the examples loop forever) and then the statistics of the emulated      **
+** chips are shown. The program returns 1 if any chip has seen a protocol error or a check of the sketch made    **
+** with hostCheck() has failed, see HostCheck.h, so it can also be used in a test script.                         **
+*******************************************************************************************************************/
+#include "Arduino.h"                                                          // Host stand-in for Arduino core   //
+#include "SPI.h"                                                              // Host stand-in for SPI library    //
+#include "SRAMEmulator.h"                                                     // Emulated memory chips            //
+#include "HostCheck.h"                                                        // Checks made by the test sketches //
+#ifndef HOST_SRAM_BYTES                                                       // Default to a 1Mbit memory        //
+  #define HOST_SRAM_BYTES 131072                                              //                                  //
+#endif                                                                        //                                  //
+#ifndef HOST_SRAM_PIN                                                         // Default CS/SS pin of examples    //
+  #define HOST_SRAM_PIN A5                                                    //                                  //
+#endif                                                                        //                                  //
+#ifndef HOST_LOOPS                                                            // Don't call loop() by default     //
+  #define HOST_LOOPS 0                                                        //                                  //
+#endif                                                                        //                                  //
+/*******************************************************************************************************************
+** The emulated chips are declared before the sketch is included, so that they are constructed before the         **
+** sketch's global MicrochipSRAM instances, which detect the memory in their constructors.                        **
+*******************************************************************************************************************/
+uint32_t     hostFailures = 0;                                                // Failed checks of the sketch      //
+SRAMEmulator hostMemory(HOST_SRAM_BYTES,HOST_SRAM_PIN);                       // First emulated memory chip       //
+#ifdef HOST_SRAM2_PIN                                                         // Optional second memory chip      //
+  #ifndef HOST_SRAM2_BYTES                                                    // of the same size as the first    //
+    #define HOST_SRAM2_BYTES HOST_SRAM_BYTES                                  // unless given                     //
+  #endif                                                                      //                                  //
+  SRAMEmulator hostMemory2(HOST_SRAM2_BYTES,HOST_SRAM2_PIN);                  //                                  //
+#endif                                                                        //                                  //
+#include SKETCH                                                               // The sketch to be run             //
+/*******************************************************************************************************************
+** Function showStatistics prints the counters of an emulated chip                                                **
+*******************************************************************************************************************/
+static void showStatistics(const SRAMEmulator &chip) {                        // Show the chip's counters         //
+  Serial.print("\nEmulated chip on pin ");  Serial.print(chip.SSPin);         //                                  //
+  Serial.print(" (");                       Serial.print(chip.bytes);         //                                  //
+  Serial.print(" bytes): ");                Serial.print(chip.transactions);  //                                  //
+  Serial.print(" transactions, ");          Serial.print(chip.bytesClocked);  //                                  //
+  Serial.print(" bytes clocked, ");         Serial.print(chip.dataBytes);     //                                  //
+  Serial.print(" data bytes, ");           Serial.print(chip.protocolErrors); //                                  //
+  Serial.println(" protocol errors");                                         //                                  //
+} // of function showStatistics                                               //----------------------------------//
+int main() {                                                                  // Run the sketch                   //
+  setup();                                                                    // Call setup() once                //
+  #if HOST_LOOPS>0                                                            // and loop() as often as required  //
+    for (unsigned long i=0;i<HOST_LOOPS;i++) loop();                          //                                  //
+  #endif                                                                      //                                  //
+  showStatistics(hostMemory);                                                 // Show statistics of the chips     //
+  uint32_t errors = hostMemory.protocolErrors;                                //                                  //
+  #ifdef HOST_SRAM2_PIN                                                       //                                  //
+    showStatistics(hostMemory2);                                              //                                  //
+    errors += hostMemory2.protocolErrors;                                     //                                  //
+  #endif                                                                      //                                  //
+  Serial.print("Emulated time: "); Serial.print(micros());                    // and the total time               //
+  Serial.println(" microseconds");                                            //                                  //
+  return (errors || hostFailures) ? 1 : 0;                                    // Fail on errors or failed checks  //
+} // of function main                                                         //----------------------------------//
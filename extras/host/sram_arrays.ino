@@ -0,0 +1,65 @@
+/*******************************************************************************************************************
+** Host sketch checking the array access of the MicrochipSRAM library against the emulated memory. 500 int16_t    **
+** samples are written and read back with the count based put() and get() across the end of the memory, where the **
+** address wraps around to 0, and a fixed size C array and std::array are moved whole with the plain put() and    **
+** get(). Each array must be transferred in one transaction and a count of 0 mustn't access the memory. Any       **
+** problem found is shown as "FAIL" and makes the program return 1. The sketch is built like the examples, see    **
+** host_main.cpp, e.g.                                                                                            **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_arrays.ino"'                       **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#include <array>                                                              // std::array of the host compiler  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+#define SAMPLES     500                                                       // Number of int16_t samples        //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+int16_t samples[SAMPLES];                                                     // Samples written to the memory    //
+int16_t readBack[SAMPLES];                                                    // Samples read from the memory     //
+                                                                              //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM array test program");               //                                  //
+  const uint32_t mask  = memory.SRAMBytes-1;                                  //                                  //
+  const uint32_t start = memory.SRAMBytes-300;                                // Wraps around to address 0        //
+  for (uint16_t i=0;i<SAMPLES;i++) samples[i] = i*37-9000;                    //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  uint32_t next = memory.put(start,samples,SAMPLES);                          // Count based put()                //
+  hostCheck(next==((start+sizeof(samples))&mask) &&                           //                                  //
+            hostMemory.memory()[0]==(uint8_t)samples[150] &&                  //                                  //
+            hostMemory.transactions==1,"put() count");                        //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  next = memory.get(start,readBack,SAMPLES);                                  // Count based get()                //
+  hostCheck(next==((start+sizeof(samples))&mask) &&                           //                                  //
+            memcmp(samples,readBack,sizeof(samples))==0 &&                    //                                  //
+            hostMemory.transactions==1,"get() count");                        //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  const int16_t *part = &samples[10];                                         // Part of a const array            //
+  memory.put(7,part,3);                                                       //                                  //
+  memset(readBack,0,sizeof(readBack));                                        //                                  //
+  memory.get(7,readBack,3);                                                   //                                  //
+  hostCheck(memcmp(part,readBack,3*sizeof(int16_t))==0 &&                     //                                  //
+            hostMemory.transactions==2,"part of an array");                   //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  hostCheck(memory.put(memory.SRAMBytes+5,samples,0)==5 &&                    // A count of 0 returns the wrapped //
+            memory.get(5,readBack,0)==5 && hostMemory.transactions==0,        // address without any transfer     //
+            "count of 0");                                                    //                                  //
+  memset(readBack,0,sizeof(readBack));                                        // Whole C array                    //
+  memory.put(start,samples);                                                  //                                  //
+  memory.get(start,readBack);                                                 //                                  //
+  hostCheck(memcmp(samples,readBack,sizeof(samples))==0 &&                    //                                  //
+            hostMemory.transactions==2,"whole array");                        //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  std::array<uint32_t,20> values, valuesBack;                                 // Whole std::array                 //
+  for (uint8_t i=0;i<20;i++) {                                                //                                  //
+    values[i]     = (uint32_t)i*i*1000;                                       //                                  //
+    valuesBack[i] = 0;                                                        //                                  //
+  } // of for-next each value                                                 //                                  //
+  next = memory.put(start,values);                                            //                                  //
+  memory.get(start,valuesBack);                                               //                                  //
+  hostCheck(values==valuesBack && next==((start+80)&mask) &&                  //                                  //
+            hostMemory.transactions==2,"std::array");                         //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
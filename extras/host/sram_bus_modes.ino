@@ -0,0 +1,88 @@
+/*******************************************************************************************************************
+** Host sketch checking the SDI (dual I/O) and SQI (quad I/O) modes of the MicrochipSRAM library against the      **
+** emulated memory and comparing their throughput with SPI. A buffer of BUFFER_BYTES bytes is written and read    **
+** back ITERATIONS times in each mode, the data read back is checked and the bytes per second and SPI clock       **
+** cycles used are shown. The modes are then switched directly from SQI to SDI and back to SPI to check that the  **
+** data survives each change. Last a new instance of the class is created with the chip left in SPI, SDI and SQI  **
+** mode, as after a reset of the MCU, and it must find the chip and switch it back to SPI mode without any        **
+** protocol errors. SDI and SQI only exist on the 23x512 and 23x1024, so for the smaller chips setBusMode() must  **
+** refuse them. Any problem found is shown as "FAIL" and makes the program return 1. The sketch is built like the **
+** examples, see host_main.cpp, e.g.                                                                              **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_bus_modes.ino"'                    **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include "SRAMHostTransport.h"                                                // Transport with 1, 2 or 4 lines   //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN  A5                                                       // Pin of the emulated memory       //
+#define BUFFER_BYTES 1024                                                     // Size of the buffer to transfer   //
+#define ITERATIONS   16                                                       // Number of transfers to time      //
+static MicrochipSRAMBase<SRAMHostMultiIO>                                     // Instantiate the memory class     //
+  memory(SRAMHostMultiIO(SRAM_SS_PIN));                                       // using the multi I/O transport    //
+                                                                              //----------------------------------//
+uint8_t buffer[BUFFER_BYTES];                                                 // Buffer written to the memory     //
+uint8_t readBack[BUFFER_BYTES];                                               // Buffer read from the memory      //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+                                                                              //----------------------------------//
+void checkData(const char* title) {                                           // Check the buffer read back       //
+  memset(readBack,0,BUFFER_BYTES);                                            //                                  //
+  memory.get(100,readBack);                                                   //                                  //
+  if (!hostCheck(memcmp(buffer,readBack,BUFFER_BYTES)==0,"data read back"))   // Show the mode of failed checks   //
+    Serial.println(title);                                                    //                                  //
+} // of method checkData                                                      //----------------------------------//
+void timeMode(const uint8_t lines, const char* title) {                       // Time put and get in one mode     //
+  if (!memory.setBusMode(lines)) {                                            // Only the larger chips have SDI   //
+    Serial.print(title);                                                      // and SQI modes                    //
+    Serial.print(": not supported\n");                                        //                                  //
+    hostCheck(memory.SRAMBytes<SRAM_512,"mode refused");                      //                                  //
+    return;                                                                   //                                  //
+  } // of if-then mode not supported                                          //                                  //
+  hostCheck(memory.getBusMode()==lines,"getBusMode()");                       //                                  //
+  for (uint16_t i=0;i<BUFFER_BYTES;i++) buffer[i] = i*lines+7;                // Different data for each mode     //
+  hostMemory.resetCounters();                                                 //                                  //
+  uint32_t startMicros = micros();                                            //                                  //
+  for (uint8_t j=0;j<ITERATIONS;j++) memory.put(100,buffer);                  //                                  //
+  for (uint8_t j=0;j<ITERATIONS;j++) memory.get(100,readBack);                //                                  //
+  uint32_t elapsed = micros()-startMicros;                                    //                                  //
+  Serial.print(title);                                                        //                                  //
+  Serial.print(": ");                                                         //                                  //
+  Serial.print((uint32_t)((uint64_t)BUFFER_BYTES*ITERATIONS*2000000/elapsed));//                                  //
+  Serial.print(" bytes/second, ");                                            //                                  //
+  Serial.print(hostMemory.clockCycles);                                       //                                  //
+  Serial.print(" clock cycles\n");                                            //                                  //
+  hostCheck(hostMemory.busWidth()==lines,"emulator lines");                   //                                  //
+  checkData(title);                                                           //                                  //
+} // of method timeMode                                                       //----------------------------------//
+void checkRestart(const uint8_t lines, const char* title) {                   // A new instance, as after a reset //
+  memory.setBusMode(lines);                                                   // of the MCU, finds the chip still //
+  uint32_t errors = hostMemory.protocolErrors;                                // in the mode it was left in       //
+  MicrochipSRAMBase<SRAMHostMultiIO> restarted(SRAMHostMultiIO(SRAM_SS_PIN)); //                                  //
+  bool ok = hostCheck(restarted.SRAMBytes==hostMemory.bytes,"size detected"); //                                  //
+  ok &= hostCheck(hostMemory.protocolErrors==errors,"protocol errors");       //                                  //
+  ok &= hostCheck(hostMemory.busWidth()==1,"emulator not in SPI");            //                                  //
+  memset(readBack,0,BUFFER_BYTES);                                            //                                  //
+  restarted.get(100,readBack);                                                //                                  //
+  ok &= hostCheck(memcmp(buffer,readBack,BUFFER_BYTES)==0,"data read back");  //                                  //
+  if (!ok) Serial.println(title);                                             // Show the mode of failed checks   //
+  memory.setBusMode(SRAM_SPI_BUS);                                            // Bring the first instance back to //
+} // of method checkRestart                                                   // SPI, the chip ignores its RSTIO  //
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM bus mode test program");            //                                  //
+  if (!hostCheck(memory.SRAMBytes!=0,"no memory detected"))                   //                                  //
+    return;                                                                   //                                  //
+  timeMode(SRAM_SPI_BUS,"SPI");                                               //                                  //
+  timeMode(SRAM_SDI_BUS,"SDI");                                               //                                  //
+  timeMode(SRAM_SQI_BUS,"SQI");                                               //                                  //
+  if (memory.SRAMBytes>=SRAM_512) {                                           // Switch directly between modes    //
+    memory.setBusMode(SRAM_SDI_BUS);                                          //                                  //
+    checkData("after SQI to SDI");                                            //                                  //
+    memory.setBusMode(SRAM_SPI_BUS);                                          //                                  //
+    checkData("after SDI to SPI");                                            //                                  //
+    hostCheck(hostMemory.busWidth()==1,"emulator not in SPI");                //                                  //
+    checkRestart(SRAM_SDI_BUS,"restart in SDI");                              // A new instance must reset the    //
+    checkRestart(SRAM_SQI_BUS,"restart in SQI");                              // chip back to SPI mode            //
+  } // of if-then chip has SDI and SQI modes                                  //                                  //
+  checkRestart(SRAM_SPI_BUS,"restart in SPI");                                // and RSTIO is ignored in SPI      //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
@@ -0,0 +1,91 @@
+/*******************************************************************************************************************
+** Host sketch checking the SRAMCache write-back cache of the MicrochipSRAM library against the emulated memory.  **
+** Random reads and writes of 1 to 70 bytes, mostly around the end of the memory where addresses wrap around to   **
+** 0, are done through a cache of 3 lines and compared with a copy of the memory kept in RAM, which must also     **
+** match the memory after flush(). 1000 read-modify-write updates of a counter must then need only one            **
+** transaction and one more when flushed, a put() of a whole page mustn't read the page first and invalidate()    **
+** must discard the cached data. Any problem found is shown as "FAIL" and makes the program return 1. The sketch  **
+** is built like the examples, see host_main.cpp, e.g.                                                            **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_cache.ino"'                        **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+#define ACCESSES    20000                                                     // Number of random accesses        //
+#define UPDATES     1000                                                      // Number of counter updates        //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+static uint8_t expected[SRAM_1024];                                           // Copy of the memory in RAM        //
+                                                                              //----------------------------------//
+void randomAccesses(SRAMCache<MicrochipSRAM,3> &cache) {                      // Random reads and writes through  //
+  const uint32_t mask = memory.SRAMBytes-1;                                   // the cache, checked against the   //
+  uint8_t buffer[70];                                                         // copy in RAM                      //
+  for (uint16_t t=0;t<ACCESSES;t++) {                                         //                                  //
+    const uint32_t addr = (t%4==0) ? rand()&mask : (rand()%200-100)&mask;     // Mostly near the memory's end     //
+    const uint8_t  bytes = 1+rand()%70;                                       //                                  //
+    if (rand()%2) {                                                           // Write byte by byte, as single    //
+      uint32_t next = addr;                                                   // bytes are the most common use    //
+      for (uint8_t i=0;i<bytes;i++) {                                         //                                  //
+        buffer[i] = rand();                                                   //                                  //
+        next = cache.put(next,buffer[i]);                                     //                                  //
+        expected[(addr+i)&mask] = buffer[i];                                  //                                  //
+      } // of for-next each byte                                              //                                  //
+      hostCheck(next==((addr+bytes)&mask),"put() address");                   //                                  //
+    } else {                                                                  // Read 4 bytes                     //
+      uint32_t value;                                                         //                                  //
+      hostCheck(cache.get(addr,value)==((addr+4)&mask),"get() address");      //                                  //
+      bool same = true;                                                       //                                  //
+      for (uint8_t i=0;i<4;i++)                                               //                                  //
+        same &= ((uint8_t*)&value)[i]==expected[(addr+i)&mask];               //                                  //
+      hostCheck(same,"get() data");                                           //                                  //
+    } // of if-then-else write                                                //                                  //
+  } // of for-next each access                                                //                                  //
+} // of method randomAccesses                                                 //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM cache test program");               //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  srand(5);                                                                   //                                  //
+  for (uint32_t i=0;i<memory.SRAMBytes;i++) expected[i] = bytes[i] = rand();  //                                  //
+  {                                                                           // Cache destroyed at end of block  //
+    SRAMCache<MicrochipSRAM,3> cache(memory);                                 //                                  //
+    randomAccesses(cache);                                                    //                                  //
+    cache.flush();                                                            //                                  //
+    hostCheck(memcmp(bytes,expected,memory.SRAMBytes)==0,                     //                                  //
+              "memory after flush()");                                        //                                  //
+    Serial.print("Hits: ");                                                   //                                  //
+    Serial.print(cache.hits);                                                 //                                  //
+    Serial.print(", misses: ");                                               //                                  //
+    Serial.print(cache.misses);                                               //                                  //
+    Serial.print(", write backs: ");                                          //                                  //
+    Serial.println(cache.writeBacks);                                         //                                  //
+    cache.invalidate();                                                       // Start with an empty cache        //
+    hostMemory.resetCounters();                                               // Updates of a counter are only    //
+    uint32_t counter = 0;                                                     // read once and written when       //
+    for (uint16_t i=0;i<UPDATES;i++) {                                        // flushed                          //
+      cache.get(64,counter);                                                  //                                  //
+      counter++;                                                              //                                  //
+      cache.put(64,counter);                                                  //                                  //
+    } // of for-next each update                                              //                                  //
+    hostCheck(hostMemory.transactions==1,"counter updates");                  //                                  //
+    cache.flush();                                                            //                                  //
+    hostCheck(hostMemory.transactions==2,"counter flush");                    //                                  //
+    uint8_t page[SRAM_PAGE_BYTES];                                            // A whole page isn't read first    //
+    memset(page,7,sizeof(page));                                              //                                  //
+    hostMemory.resetCounters();                                               //                                  //
+    cache.put(SRAM_PAGE_BYTES*100,page);                                      //                                  //
+    cache.flush();                                                            //                                  //
+    hostCheck(hostMemory.transactions==1 && bytes[SRAM_PAGE_BYTES*100]==7,    //                                  //
+              "whole page put()");                                            //                                  //
+    bytes[3201] = 9;                                                          // Changed without using the cache  //
+    cache.invalidate();                                                       //                                  //
+    uint8_t value = 0;                                                        //                                  //
+    cache.get(3201,value);                                                    //                                  //
+    hostCheck(value==9,"invalidate()");                                       //                                  //
+    cache.put(10,value);                                                      // Written by the destructor        //
+  } // of block using the cache                                               //                                  //
+  hostCheck(bytes[10]==9,"destructor");                                       //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
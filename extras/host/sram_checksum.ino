@@ -0,0 +1,77 @@
+/*******************************************************************************************************************
+** Host sketch checking checksum() of the MicrochipSRAM library against the emulated memory. The check value of   **
+** both algorithms for "123456789" is computed with the text wrapping around the end of the memory, then random   **
+** regions of up to 5000 bytes are compared with a bit by bit CRC computed in RAM. Each checksum must take one    **
+** READ transaction of exactly the bytes of the region and an unknown algorithm must return 0 without using the   **
+** bus. Any problem found is shown as "FAIL" and makes the program return 1. The sketch is built like the         **
+** examples, see host_main.cpp, and adding -DSRAM_CRC_NIBBLE checks the kernels used on AVR processors, e.g.      **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_checksum.ino"'                     **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN  A5                                                       // Pin of the emulated memory       //
+#define RANDOM_TESTS 200                                                      // Number of random regions         //
+#define MAX_LENGTH   5000                                                     // Longest region                   //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+                                                                              //----------------------------------//
+uint32_t referenceCRC(const uint32_t addr,const uint32_t length,              // Bit by bit CRC of the emulated   //
+                      const uint8_t algorithm) {                              // memory, without any tables       //
+  const uint32_t mask  = memory.SRAMBytes-1;                                  //                                  //
+  const uint8_t *bytes = hostMemory.memory();                                 //                                  //
+  uint32_t crc = (algorithm==SRAM_CRC32) ? 0xFFFFFFFF : 0xFFFF;               //                                  //
+  for (uint32_t i=0;i<length;i++) {                                           //                                  //
+    const uint8_t data = bytes[(addr+i)&mask];                                //                                  //
+    for (uint8_t bit=0;bit<8;bit++) {                                         //                                  //
+      if (algorithm==SRAM_CRC32) {                                            // Reflected, polynomial 0x04C11DB7 //
+        const bool xorPoly = (crc^(data>>bit))&1;                             //                                  //
+        crc = (crc>>1)^(xorPoly ? 0xEDB88320 : 0);                            //                                  //
+      } else {                                                                // Polynomial 0x1021, MSB first     //
+        const bool xorPoly = ((crc>>15)^(data>>(7-bit)))&1;                   //                                  //
+        crc = ((crc<<1)^(xorPoly ? 0x1021 : 0))&0xFFFF;                       //                                  //
+      } // of if-then-else CRC-32                                             //                                  //
+    } // of for-next each bit                                                 //                                  //
+  } // of for-next each byte                                                  //                                  //
+  return (algorithm==SRAM_CRC32) ? ~crc : crc;                                //                                  //
+} // of method referenceCRC                                                   //----------------------------------//
+void checkCRC(const uint32_t addr,const uint32_t length,                      // Show FAIL unless checksum()      //
+              const uint8_t algorithm,const uint32_t expected) {              // returns "expected" in one READ   //
+  hostMemory.resetCounters();                                                 // of the region's bytes            //
+  if (!hostCheck(memory.checksum(addr,length,algorithm)==expected &&          //                                  //
+                 hostMemory.transactions==1 && hostMemory.dataBytes==length,  //                                  //
+                 "checksum()")) {                                             // Show the failed region           //
+    Serial.print("CRC-");                                                     //                                  //
+    Serial.print(algorithm);                                                  //                                  //
+    Serial.print(" at ");                                                     //                                  //
+    Serial.print(addr);                                                       //                                  //
+    Serial.print(" length ");                                                 //                                  //
+    Serial.println(length);                                                   //                                  //
+  } // of if-then check failed                                                //                                  //
+} // of method checkCRC                                                       //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM checksum test program");            //                                  //
+  const uint32_t mask = memory.SRAMBytes-1;                                   //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  for (uint8_t i=0;i<9;i++) bytes[(mask-3+i)&mask] = "123456789"[i];          // Check values of the algorithms   //
+  checkCRC(mask-3,9,SRAM_CRC16_CCITT,0x29B1);                                 // wrapping around the end          //
+  checkCRC(mask-3,9,SRAM_CRC32,0xCBF43926);                                   //                                  //
+  checkCRC(100,0,SRAM_CRC16_CCITT,0xFFFF);                                    // Initial values for no data       //
+  checkCRC(100,0,SRAM_CRC32,0);                                               //                                  //
+  srand(5);                                                                   //                                  //
+  for (uint32_t i=0;i<memory.SRAMBytes;i++) bytes[i] = rand();                //                                  //
+  for (uint16_t t=0;t<RANDOM_TESTS;t++) {                                     // Random regions with both         //
+    const uint32_t addr   = rand()&mask;                                      // algorithms                       //
+    const uint32_t length = rand()%(MAX_LENGTH+1);                            //                                  //
+    checkCRC(addr,length,SRAM_CRC16_CCITT,                                    //                                  //
+             referenceCRC(addr,length,SRAM_CRC16_CCITT));                     //                                  //
+    checkCRC(addr,length,SRAM_CRC32,referenceCRC(addr,length,SRAM_CRC32));    //                                  //
+  } // of for-next each random test                                           //                                  //
+  hostMemory.resetCounters();                                                 // Unknown algorithm                //
+  hostCheck(memory.checksum(0,100,7)==0 && hostMemory.transactions==0,        //                                  //
+            "unknown algorithm");                                             //                                  //
+  Serial.println("Done");                                                     //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
@@ -0,0 +1,71 @@
+/*******************************************************************************************************************
+** Host sketch checking compare() and compareRegions() of the MicrochipSRAM library against the emulated memory.  **
+** Random regions, wrapping around the end of the memory, are compared with a buffer and with another region,     **
+** either identical or with one byte changed at a random offset, and the offset returned must be the one found by **
+** a byte-by-byte comparison in RAM. compare() must take one READ transaction and compareRegions() two for each   **
+** half of SRAM_COPY_BYTES, and both must stop reading at the end of the chunk with the first difference. Any     **
+** problem found is shown as "FAIL" and makes the program return 1. The sketch is built like the examples, see    **
+** host_main.cpp, e.g.                                                                                            **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_compare.ino"'                      **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN  A5                                                       // Pin of the emulated memory       //
+#define RANDOM_TESTS 500                                                      // Number of random comparisons     //
+#define MAX_LENGTH   3000                                                     // Longest region compared          //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+static uint8_t buffer[MAX_LENGTH];                                            // Buffer compared with the memory  //
+                                                                              //----------------------------------//
+uint32_t bytesRead(const uint32_t found,const uint32_t length,                // Bytes read in chunks of "chunk"  //
+                   const uint32_t chunk) {                                    // up to the first difference       //
+  const uint32_t bytes = (found/chunk+1)*chunk;                               //                                  //
+  return (bytes<length) ? bytes : length;                                     //                                  //
+} // of method bytesRead                                                      //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM compare test program");             //                                  //
+  const uint32_t mask = memory.SRAMBytes-1;                                   //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  srand(3);                                                                   //                                  //
+  for (uint32_t i=0;i<memory.SRAMBytes;i++) bytes[i] = rand();                //                                  //
+  for (uint16_t t=0;t<RANDOM_TESTS;t++) {                                     //                                  //
+    const uint32_t addrA  = (t<10) ? mask-t*100 : rand()&mask;                // Wrap the first ones              //
+    const uint32_t addrB  = rand()&mask;                                      //                                  //
+    const uint32_t length = 1+rand()%MAX_LENGTH;                              //                                  //
+    for (uint32_t i=0;i<length;i++) {                                         // Region B and the buffer are      //
+      buffer[i] = bytes[(addrA+i)&mask];                                      // made equal to region A, unless   //
+      if (((addrB-addrA)&mask)>=length && ((addrA-addrB)&mask)>=length)       // the regions overlap              //
+        bytes[(addrB+i)&mask] = buffer[i];                                    //                                  //
+    } // of for-next each byte                                                //                                  //
+    if (rand()%4) {                                                           // Mostly change one byte of the    //
+      const uint32_t offset = rand()%length;                                  // buffer and region B              //
+      buffer[offset] ^= 1<<(rand()%8);                                        //                                  //
+      bytes[(addrB+offset)&mask] ^= 0x80;                                     //                                  //
+    } // of if-then change a byte                                             //                                  //
+    uint32_t found = 0;                                                       // Offsets of the first difference  //
+    while (found<length && buffer[found]==bytes[(addrA+found)&mask]) found++; // found in RAM                     //
+    uint32_t foundB = 0;                                                      //                                  //
+    while (foundB<length &&                                                   //                                  //
+           bytes[(addrB+foundB)&mask]==bytes[(addrA+foundB)&mask]) foundB++;  //                                  //
+    hostMemory.resetCounters();                                               //                                  //
+    hostCheck(memory.compare(addrA,buffer,length)==found &&                   // One READ, up to the chunk with   //
+              hostMemory.transactions==1 &&                                   // the difference                   //
+              hostMemory.dataBytes==bytesRead(found,length,SRAM_COPY_BYTES),  //                                  //
+              "compare()");                                                   //                                  //
+    const uint32_t half = SRAM_COPY_BYTES/2;                                  // Two READs for each half chunk    //
+    hostMemory.resetCounters();                                               //                                  //
+    const uint32_t regionBytes = bytesRead(foundB,length,half);               //                                  //
+    hostCheck(memory.compareRegions(addrA,addrB,length)==foundB &&            //                                  //
+              hostMemory.dataBytes==2*regionBytes &&                          //                                  //
+              hostMemory.transactions==2*((regionBytes+half-1)/half),         //                                  //
+              "compareRegions()");                                            //                                  //
+  } // of for-next each random test                                           //                                  //
+  hostMemory.resetCounters();                                                 // Nothing to compare               //
+  hostCheck(memory.compare(0,buffer,0)==0 &&                                  //                                  //
+            memory.compareRegions(0,5,0)==0,"empty region");                  //                                  //
+  Serial.println("Done");                                                     //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
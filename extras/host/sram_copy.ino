@@ -0,0 +1,72 @@
+/*******************************************************************************************************************
+** Host sketch checking copy() and move() of the MicrochipSRAM library against the emulated memory. Fixed cases   **
+** with regions overlapping in both directions, wrapping around the end of the memory and of the same address are **
+** followed by random ones, each compared with a copy of the memory in RAM which is changed like memmove() would. **
+** The returned address must be the one after the destination and every chunk of SRAM_COPY_BYTES bytes must take  **
+** one READ and one WRITE transaction, so copying nothing must take none. Any problem found is shown as "FAIL"    **
+** and makes the program return 1. The sketch is built like the examples, see host_main.cpp, e.g.                 **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_copy.ino"'                         **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+#define RANDOM_TESTS 200                                                      // Number of random copies          //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+static uint8_t original[SRAM_1024];                                           // Memory before the copy           //
+static uint8_t expected[SRAM_1024];                                           // Memory expected after the copy   //
+                                                                              //----------------------------------//
+void checkCopy(const uint32_t dst,const uint32_t src,const uint32_t length,   // Copy or move "length" bytes      //
+               const bool moving) {                                           // and compare with the copy        //
+  const uint32_t mask = memory.SRAMBytes-1;                                   // changed in RAM                   //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  for (uint32_t i=0;i<memory.SRAMBytes;i++) original[i] = bytes[i] = rand();  //                                  //
+  memcpy(expected,original,memory.SRAMBytes);                                 //                                  //
+  for (uint32_t i=0;i<length;i++)                                             // Like memmove(), the bytes are    //
+    expected[(dst+i)&mask] = original[(src+i)&mask];                          // those before the copy            //
+  hostMemory.resetCounters();                                                 //                                  //
+  const uint32_t next = moving ? memory.move(dst,src,length)                  //                                  //
+                               : memory.copy(dst,src,length);                 //                                  //
+  const uint32_t chunks = (length+SRAM_COPY_BYTES-1)/SRAM_COPY_BYTES;         //                                  //
+  if (!hostCheck(memcmp(bytes,expected,memory.SRAMBytes)==0 &&                //                                  //
+                 next==((dst+length)&mask) &&                                 //                                  //
+                 hostMemory.transactions==2*chunks,                           //                                  //
+                 moving ? "move()" : "copy()")) {                             // Show the failed arguments        //
+    Serial.print("(");                                                        //                                  //
+    Serial.print(dst);                                                        //                                  //
+    Serial.print(",");                                                        //                                  //
+    Serial.print(src);                                                        //                                  //
+    Serial.print(",");                                                        //                                  //
+    Serial.print(length);                                                     //                                  //
+    Serial.println(")");                                                      //                                  //
+  } // of if-then copy wrong                                                  //                                  //
+} // of method checkCopy                                                      //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM copy and move test program");       //                                  //
+  const uint32_t bytes = memory.SRAMBytes;                                    //                                  //
+  srand(1);                                                                   //                                  //
+  checkCopy(1000,0,3000,true);                                                // Destination above the source     //
+  checkCopy(0,1000,3000,true);                                                // Destination below the source     //
+  checkCopy(10,0,5000,true);                                                  // Overlapping by almost all        //
+  checkCopy(0,10,5000,true);                                                  //                                  //
+  checkCopy(bytes-100,bytes-300,700,true);                                    // Both regions wrapping            //
+  checkCopy(bytes-300,bytes-100,700,true);                                    //                                  //
+  checkCopy(7,7,100,true);                                                    // Same region                      //
+  checkCopy(5,bytes-5,0,true);                                                // Nothing to copy                  //
+  checkCopy(5000,100,1000,false);                                             // Separate regions                 //
+  checkCopy(100,5000,1000,false);                                             //                                  //
+  checkCopy(0,bytes/2,bytes/2,false);                                         // Half of the memory               //
+  checkCopy(bytes-10,20,SRAM_COPY_BYTES,false);                               // One chunk, wrapping              //
+  for (uint16_t t=0;t<RANDOM_TESTS;t++) {                                     // Random moves of up to half of    //
+    const uint32_t src    = rand()&(bytes-1);                                 // the memory, so the regions       //
+    const uint32_t length = rand()%(bytes/2+1);                               // overlap at one end at most       //
+    const uint32_t dst    = (rand()%2) ? (src+rand()%(length+1))&(bytes-1)    //                                  //
+                                       : rand()&(bytes-1);                    //                                  //
+    checkCopy(dst,src,length,true);                                           //                                  //
+  } // of for-next each random move                                           //                                  //
+  Serial.println("Done");                                                     //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
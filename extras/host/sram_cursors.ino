@@ -0,0 +1,97 @@
+/*******************************************************************************************************************
+** Host sketch checking the SRAMReader and SRAMWriter cursors of the MicrochipSRAM library against the emulated   **
+** memory. A writer started shortly before the end of the memory must write all values in one transaction,        **
+** wrapping around to address 0 like the memory, and its address() must wrap at SRAMBytes in the same way. A      **
+** reader must read the values back, start a new transaction at its address when it is used again after end(),    **
+** and begin() must move it to a new address. Finally STREAM_BYTES random bytes are streamed through a writer and **
+** a reader, one transaction each, and compared with the memory. Any problem found is shown as "FAIL" and makes   **
+** the program return 1. The sketch is built like the examples, see host_main.cpp, e.g.                           **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_cursors.ino"'                      **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN  A5                                                       // Pin of the emulated memory       //
+#define VALUES       20                                                       // int16_t values written near end  //
+#define STREAM_BYTES 5000                                                     // Random bytes streamed at the end //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+static uint8_t stream[STREAM_BYTES];                                          // Random bytes streamed            //
+                                                                              //----------------------------------//
+bool transactions(const uint32_t count) {                                     // True if the emulator has seen    //
+  const bool ok = hostMemory.transactions==count &&                           // "count" transactions and no      //
+                  hostMemory.protocolErrors==0;                               // protocol errors                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  return ok;                                                                  //                                  //
+} // of method transactions                                                   //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM cursor test program");              //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  const uint32_t mask  = memory.SRAMBytes-1;                                  //                                  //
+  const uint32_t start = memory.SRAMBytes-10;                                 // 5 values before the end, so the  //
+  memset(bytes,0xEE,memory.SRAMBytes);                                        // rest wrap around to address 0    //
+  hostMemory.resetCounters();                                                 //                                  //
+  {                                                                           // Scope of the writer              //
+    SRAMWriter<> writer(memory,start);                                        //                                  //
+    uint32_t next = 0;                                                        //                                  //
+    for (int16_t i=0;i<VALUES;i++) next = writer.write(i);                    //                                  //
+    hostCheck(next==((start+VALUES*2)&mask) && writer.address()==next,        // address() wraps at SRAMBytes     //
+              "writer address");                                              //                                  //
+  } // of writer scope                                                        // Destructor ends the transaction  //
+  hostCheck(hostMemory.bytesClocked<=VALUES*2+4 && transactions(1),           // Command and address sent once    //
+            "writer transaction");                                            //                                  //
+  bool same = bytes[(start+VALUES*2)&mask]==0xEE && bytes[start-1]==0xEE;     // Nothing written outside          //
+  for (int16_t i=0;i<VALUES;i++) {                                            //                                  //
+    const uint32_t addr = (start+i*2)&mask;                                   //                                  //
+    same &= bytes[addr]==(uint8_t)i && bytes[(addr+1)&mask]==0;               //                                  //
+  } // of for-next each value                                                 //                                  //
+  hostCheck(same,"writer data wrapping at SRAMBytes");                        //                                  //
+  SRAMReader<> reader(memory,start);                                          //                                  //
+  same = true;                                                                //                                  //
+  for (int16_t i=0;i<VALUES/2;i++) same &= reader.read<int16_t>()==i;         // First half in one transaction    //
+  reader.end();                                                               //                                  //
+  hostCheck(same && transactions(1),"reader data");                           //                                  //
+  int16_t  value = 0;                                                         // Second half restarts at the      //
+  uint32_t next  = 0;                                                         // cursor's address, wrapping       //
+  for (int16_t i=VALUES/2;i<VALUES;i++) {                                     // around to address 0              //
+    next = reader.read(value);                                                //                                  //
+    same &= value==i;                                                         //                                  //
+  } // of for-next each value                                                 //                                  //
+  reader.end();                                                               //                                  //
+  hostCheck(same && next==((start+VALUES*2)&mask) && transactions(1),         //                                  //
+            "reader restart after end()");                                    //                                  //
+  reader.begin(start+8);                                                      // Seek to the 5th value, which is  //
+  hostCheck(reader.read<int16_t>()==4 && reader.read<int16_t>()==5,           // the last one before the end      //
+            "begin() to a new address");                                      //                                  //
+  reader.begin(start+2*VALUES-2);                                             // and to the last value, a seek    //
+  hostCheck(reader.read<int16_t>()==VALUES-1 &&                               // is one new transaction each      //
+            reader.address()==((start+2*VALUES)&mask) && transactions(2),     //                                  //
+            "begin() to a wrapped address");                                  //                                  //
+  reader.end();                                                               //                                  //
+  hostCheck(memory.get(start,value)==start+2 && value==0 && transactions(1),  // The memory is usable again       //
+            "get() after end()");                                             //                                  //
+  srand(5);                                                                   // Stream random bytes in small     //
+  for (uint16_t i=0;i<STREAM_BYTES;i++) stream[i] = rand();                   // blocks of different sizes        //
+  const uint32_t base = rand()&mask;                                          //                                  //
+  {                                                                           // Scope of the writer              //
+    SRAMWriter<> writer(memory,base);                                         //                                  //
+    for (uint16_t done=0,chunk=0;done<STREAM_BYTES;done+=chunk) {             //                                  //
+      chunk = rand()%17;                                                      //                                  //
+      if (chunk>STREAM_BYTES-done) chunk = STREAM_BYTES-done;                 //                                  //
+      writer.write(&stream[done],chunk);                                      //                                  //
+    } // of for-next each block                                               //                                  //
+  } // of writer scope                                                        //                                  //
+  same = true;                                                                //                                  //
+  for (uint16_t i=0;i<STREAM_BYTES;i++)                                       //                                  //
+    same &= bytes[(base+i)&mask]==stream[i];                                  //                                  //
+  hostCheck(same && transactions(1),"streamed writes");                       //                                  //
+  SRAMReader<> streamReader(memory,base);                                     //                                  //
+  same = true;                                                                //                                  //
+  for (uint16_t i=0;i<STREAM_BYTES;i++)                                       //                                  //
+    same &= streamReader.read<uint8_t>()==stream[i];                          //                                  //
+  streamReader.end();                                                         //                                  //
+  hostCheck(same && transactions(1),"streamed reads");                        //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
@@ -0,0 +1,66 @@
+/*******************************************************************************************************************
+** Host sketch checking getField() and putField() of the MicrochipSRAM library against the emulated memory. A     **
+** structure of several hundred bytes is written to the end of the memory so that it wraps around to address 0,   **
+** and single members are then read and written using SRAM_FIELD() and plain offsets. Each access must use one    **
+** transaction and transfer only the bytes of the member, and a value of another type must be converted to the    **
+** member's type. Any problem found is shown as "FAIL" and makes the program return 1. The sketch is built like   **
+** the examples, see host_main.cpp, e.g.                                                                          **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_fields.ino"'                       **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+struct Record {                                                               // Large structure in the memory    //
+  uint32_t id;                                                                //                                  //
+  uint8_t  name[300];                                                         //                                  //
+  uint16_t count;                                                             //                                  //
+  float    value;                                                             //                                  //
+  uint8_t  tail[3];                                                           //                                  //
+}; // of struct Record                                                        //                                  //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+                                                                              //----------------------------------//
+bool transferred(const uint32_t dataBytes) {                                  // True if the access used one      //
+  const bool ok = hostMemory.transactions==1 &&                               // transaction of "dataBytes" bytes //
+                  hostMemory.dataBytes==dataBytes;                            //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  return ok;                                                                  //                                  //
+} // of method transferred                                                    //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM field test program");               //                                  //
+  Record record;                                                              //                                  //
+  memset(&record,0,sizeof(record));                                           //                                  //
+  record.id    = 7;                                                           //                                  //
+  record.count = 3;                                                           //                                  //
+  record.value = 1.5f;                                                        //                                  //
+  const uint32_t base = memory.SRAMBytes-310;                                 // Wraps around to address 0        //
+  memory.put(base,record);                                                    //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  uint16_t count = 0;                                                         //                                  //
+  uint32_t next  = memory.getField(base,SRAM_FIELD(Record,count),count);      //                                  //
+  hostCheck(transferred(2) && count==3 &&                                     // Next address follows the member  //
+            next==((base+offsetof(Record,count)+2)&(memory.SRAMBytes-1)),     //                                  //
+            "getField()");                                                    //                                  //
+  memory.putField(base,SRAM_FIELD(Record,count),99);                          // int converted to uint16_t        //
+  hostCheck(transferred(2),"putField() of an int");                           //                                  //
+  memory.putField(base,SRAM_FIELD(Record,value),2.25);                        // double converted to float        //
+  hostCheck(transferred(4),"putField() of a double");                         //                                  //
+  const uint8_t tail[3] = {1,2,3};                                            //                                  //
+  memory.putField(base,SRAM_FIELD(Record,tail),tail);                         // Array member                     //
+  hostCheck(transferred(3),"putField() of an array");                         //                                  //
+  float value = 0;                                                            //                                  //
+  memory.getField(base,offsetof(Record,value),value);                         // Plain offset                     //
+  hostCheck(transferred(4) && value==2.25f,"getField() at an offset");        //                                  //
+  value = 4.5f;                                                               //                                  //
+  memory.putField(base,offsetof(Record,value),value);                         //                                  //
+  hostCheck(transferred(4),"putField() at an offset");                        //                                  //
+  Record readBack;                                                            // Only the members written have    //
+  memory.get(base,readBack);                                                  // changed                          //
+  hostCheck(readBack.id==7 && readBack.count==99 && readBack.value==4.5f &&   //                                  //
+            readBack.tail[2]==3 && readBack.name[299]==0,                     //                                  //
+            "structure read back");                                           //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
@@ -0,0 +1,91 @@
+/*******************************************************************************************************************
+** Host sketch checking the SRAMLazyClear page bitmap of the MicrochipSRAM library against the emulated memory,   **
+** with a bitmap for 64KB so that the 23x1024 has memory above it which is cleared directly. Clearing the memory  **
+** must not use the bus for the part covered by the bitmap, reading a cleared page must not use the bus, a put()  **
+** must only fill the cleared pages it partly covers and flush() must fill adjacent cleared pages in one          **
+** transaction. Random put(), get() and ranged clears with different values, wrapping around the end of the       **
+** memory, are then compared with a copy of the memory kept in RAM, which must also match the memory after        **
+** flush(). Any problem found is shown as "FAIL" and makes the program return 1. The sketch is built like the     **
+** examples, see host_main.cpp, e.g.                                                                              **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_lazy_clear.ino"'                   **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+#define ACCESSES    20000                                                     // Number of random accesses        //
+struct Block {                                                                // Structure of 45 bytes, so that   //
+  uint8_t data[45];                                                           // it covers 2 or 3 pages           //
+}; // of struct Block                                                         //                                  //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+static SRAMLazyClear<MicrochipSRAM,SRAM_512> lazy(memory);                    // Bitmap for 64KB                  //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+static uint8_t expected[SRAM_1024];                                           // Copy of the memory in RAM        //
+                                                                              //----------------------------------//
+bool transactions(const uint32_t count) {                                     // True if the emulator has seen    //
+  const bool ok = hostMemory.transactions==count;                             // "count" transactions             //
+  hostMemory.resetCounters();                                                 //                                  //
+  return ok;                                                                  //                                  //
+} // of method transactions                                                   //----------------------------------//
+void randomAccesses() {                                                       // Random accesses through the      //
+  const uint32_t mask = memory.SRAMBytes-1;                                   // bitmap, checked against the      //
+  Block block;                                                                // copy in RAM                      //
+  for (uint16_t t=0;t<ACCESSES;t++) {                                         //                                  //
+    const uint32_t addr = rand()&mask;                                        //                                  //
+    const uint8_t  operation = rand()%10;                                     //                                  //
+    if (operation<4) {                                                        // Write a block                    //
+      for (uint8_t i=0;i<sizeof(block);i++) block.data[i] = rand();           //                                  //
+      lazy.put(addr,block);                                                   //                                  //
+      for (uint8_t i=0;i<sizeof(block);i++)                                   //                                  //
+        expected[(addr+i)&mask] = block.data[i];                              //                                  //
+    } else if (operation<8) {                                                 // Read a block                     //
+      hostCheck(lazy.get(addr,block)==((addr+sizeof(block))&mask),            //                                  //
+                "get() address");                                             //                                  //
+      bool same = true;                                                       //                                  //
+      for (uint8_t i=0;i<sizeof(block);i++)                                   //                                  //
+        same &= block.data[i]==expected[(addr+i)&mask];                       //                                  //
+      hostCheck(same,"get() data");                                           //                                  //
+    } else if (operation<9) {                                                 // Clear a range, mostly to the     //
+      const uint16_t length = rand()%300;                                     // same value                       //
+      const uint8_t  value  = (rand()%4==0) ? rand() : 0x55;                  //                                  //
+      lazy.clearMemory(addr,length,value);                                    //                                  //
+      for (uint16_t i=0;i<length;i++) expected[(addr+i)&mask] = value;        //                                  //
+    } else if (rand()%200==0) {                                               // Occasionally clear everything    //
+      const uint8_t value = rand();                                           //                                  //
+      lazy.clearMemory(value);                                                //                                  //
+      memset(expected,value,memory.SRAMBytes);                                //                                  //
+    } // of if-then-else operation                                            //                                  //
+  } // of for-next each access                                                //                                  //
+} // of method randomAccesses                                                 //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM lazy clear test program");          //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  srand(11);                                                                  //                                  //
+  for (uint32_t i=0;i<memory.SRAMBytes;i++) expected[i] = bytes[i] = rand();  //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  lazy.clearMemory(0x55);                                                     // Memory above the bitmap is       //
+  memset(expected,0x55,memory.SRAMBytes);                                     // cleared directly                 //
+  hostCheck(transactions(memory.SRAMBytes>SRAM_512 ? 1 : 0),"clearMemory()"); //                                  //
+  uint32_t value = 0;                                                         // Cleared page read locally        //
+  lazy.get(100,value);                                                        //                                  //
+  hostCheck(transactions(0) && value==0x55555555 && lazy.hits==4,             //                                  //
+            "get() of a cleared page");                                       //                                  //
+  const Block block = {{1,2,3}};                                              // 45 bytes from the middle of a    //
+  lazy.put(SRAM_PAGE_BYTES*10+16,block);                                      // page fill 2 partial pages, plus  //
+  for (uint8_t i=0;i<sizeof(block);i++)                                       // 1 write                          //
+    expected[SRAM_PAGE_BYTES*10+16+i] = block.data[i];                        //                                  //
+  hostCheck(transactions(3) && bytes[SRAM_PAGE_BYTES*10]==0x55 &&             //                                  //
+            bytes[SRAM_PAGE_BYTES*11+31]==0x55,"put() over 2 cleared pages"); //                                  //
+  lazy.flush();                                                               // The remaining cleared pages are  //
+  hostCheck(transactions(2) && memcmp(bytes,expected,memory.SRAMBytes)==0,    // in 2 runs around the block       //
+            "flush()");                                                       //                                  //
+  randomAccesses();                                                           //                                  //
+  lazy.flush();                                                               //                                  //
+  hostCheck(memcmp(bytes,expected,memory.SRAMBytes)==0,                       //                                  //
+            "memory after random accesses");                                  //                                  //
+  Serial.print("Bytes read from cleared pages: ");                            //                                  //
+  Serial.println(lazy.hits);                                                  //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
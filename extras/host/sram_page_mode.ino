@@ -0,0 +1,69 @@
+/*******************************************************************************************************************
+** Host sketch checking the page mode and the cached mode register of the MicrochipSRAM library against the       **
+** emulated memory. putPage() and getPage() on the last page of the memory must wrap around within the 32 byte    **
+** page and return the next address in the page, without touching the first byte of the memory where sequential   **
+** mode would continue. Setting the mode already in use must not use the bus, setMode() must refuse page and byte **
+** mode, getMode(true) must read the register from the chip and switching back to sequential mode must cost       **
+** exactly one WRMR instruction. Any problem found is shown as "FAIL" and makes the program return 1. The sketch  **
+** is built like the examples, see host_main.cpp, e.g.                                                            **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_page_mode.ino"'                    **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+                                                                              //----------------------------------//
+bool transactions(const uint32_t count) {                                     // True if the emulator has seen    //
+  const bool ok = hostMemory.transactions==count;                             // "count" transactions             //
+  hostMemory.resetCounters();                                                 //                                  //
+  return ok;                                                                  //                                  //
+} // of method transactions                                                   //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM page mode test program");           //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  memset(bytes,0,memory.SRAMBytes);                                           //                                  //
+  hostCheck(memory.getMode()==SRAM_SEQ_MODE &&                                // Constructor sets sequential mode //
+            memory.getMode(true)==SRAM_SEQ_MODE,"initial mode");              //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  hostCheck(memory.setMode(SRAM_SEQ_MODE) && transactions(0),                 // Cached mode isn't written again  //
+            "repeated setMode()");                                            //                                  //
+  hostCheck(!memory.setMode(SRAM_PAGE_MODE) &&                                // Page and byte mode are refused   //
+            !memory.setMode(SRAM_BYTE_MODE) && transactions(0) &&             //                                  //
+            memory.getMode()==SRAM_SEQ_MODE,"setMode() refuses other modes"); //                                  //
+  const uint32_t page = memory.SRAMBytes-SRAM_PAGE_BYTES;                     // Last page of the memory, where   //
+  const uint32_t value = 0x11223344;                                          // sequential mode would wrap to 0  //
+  hostCheck(memory.putPage(page+28,value)==page && transactions(2),           // WRMR and a write, ending on the  //
+            "putPage() next address");                                        // first byte of the page           //
+  hostCheck(bytes[page+28]==0x44 && bytes[page+31]==0x11 && bytes[0]==0,      //                                  //
+            "putPage() data");                                                //                                  //
+  const uint64_t big = 0x0102030405060708ULL;                                 // 8 bytes wrapping after 2         //
+  hostCheck(memory.putPage(page+30,big)==page+6 && transactions(1),           // Page mode is cached now          //
+            "putPage() wrapping");                                            //                                  //
+  hostCheck(bytes[page+30]==0x08 && bytes[page+31]==0x07 &&                   //                                  //
+            bytes[page]==0x06 && bytes[page+5]==0x01 && bytes[0]==0,          //                                  //
+            "putPage() wrapped data");                                        //                                  //
+  uint64_t readBack = 0;                                                      //                                  //
+  hostCheck(memory.getPage(page+30,readBack)==page+6 && readBack==big &&      //                                  //
+            transactions(1),"getPage()");                                     //                                  //
+  hostCheck(memory.getMode()==SRAM_PAGE_MODE && transactions(0),              //                                  //
+            "cached page mode");                                              //                                  //
+  MicrochipSRAM other(SRAM_SS_PIN);                                           // A second instance sets the chip  //
+  hostMemory.resetCounters();                                                 // to sequential mode, which only   //
+  hostCheck(memory.getMode()==SRAM_PAGE_MODE && transactions(0) &&            // reading the register finds       //
+            memory.getMode(true)==SRAM_SEQ_MODE && transactions(1) &&         //                                  //
+            memory.getMode()==SRAM_SEQ_MODE,"getMode(true)");                 //                                  //
+  hostCheck(memory.getPage(page+28,readBack)==page+4 && transactions(2),      // Back to page mode                //
+            "getPage() after sequential mode");                               //                                  //
+  hostCheck(memory.setMode(SRAM_SEQ_MODE) && hostMemory.bytesClocked==2 &&    // One WRMR back to sequential mode //
+            transactions(1),"setMode() back to sequential mode");             //                                  //
+  hostCheck(memory.getMode(true)==SRAM_SEQ_MODE,"sequential mode in chip");   //                                  //
+  hostMemory.resetCounters();                                                 //                                  //
+  hostCheck(memory.put(page+28,big)==4 && transactions(1) &&                  // Sequential mode wraps to 0       //
+            bytes[0]==0x04 && bytes[3]==0x01,"put() after page mode");        //                                  //
+  hostCheck(hostMemory.protocolErrors==0,"protocol errors");                  //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
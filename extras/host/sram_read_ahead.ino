@@ -0,0 +1,69 @@
+/*******************************************************************************************************************
+** Host sketch checking the SRAMReadAhead prefetch window of the MicrochipSRAM library against the emulated       **
+** memory. 100 records of 6 bytes are read in order across the end of the memory, where addresses wrap around to  **
+** 0, through a window of 128 bytes, which must take 6 transactions instead of 100. A put() overlapping the       **
+** window from inside it, from before its start and across the end of the memory must discard it, while reads at  **
+** random addresses mustn't read ahead at all. Every record read is compared with the emulator's memory. Any      **
+** problem found is shown as "FAIL" and makes the program return 1. The sketch is built like the examples, see    **
+** host_main.cpp, e.g.                                                                                            **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_read_ahead.ino"'                   **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+#define RECORDS     100                                                       // Number of records read in order  //
+struct Record {                                                               // Small record of 6 bytes          //
+  uint16_t id;                                                                //                                  //
+  uint8_t  data[4];                                                           //                                  //
+}; // of struct Record                                                        //                                  //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+static SRAMReadAhead<MicrochipSRAM,128> readAhead(memory);                    // Window of 128 bytes              //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+                                                                              //----------------------------------//
+uint32_t getRecord(const uint32_t addr,const char* title) {                   // Read a record through the window //
+  Record record;                                                              // and compare it with the memory   //
+  const uint32_t mask = memory.SRAMBytes-1;                                   //                                  //
+  const uint32_t next = readAhead.get(addr,record);                           //                                  //
+  bool same = next==((addr+sizeof(record))&mask);                             //                                  //
+  for (uint8_t i=0;i<sizeof(record);i++)                                      //                                  //
+    same &= ((uint8_t*)&record)[i]==hostMemory.memory()[(addr+i)&mask];       //                                  //
+  hostCheck(same,title);                                                      //                                  //
+  return next;                                                                //                                  //
+} // of method getRecord                                                      //----------------------------------//
+void checkOverlap(const uint32_t start,const uint32_t addr,                   // Read 3 records from "start" to   //
+                  const char* title) {                                        // fill the window, overwrite one   //
+  const uint32_t mask = memory.SRAMBytes-1;                                   // at "addr" and read them again    //
+  uint32_t next = start;                                                      //                                  //
+  for (uint8_t i=0;i<3;i++) next = getRecord(next,title);                     //                                  //
+  Record record = {(uint16_t)rand(),{1,2,3,4}};                               //                                  //
+  readAhead.put(addr,record);                                                 //                                  //
+  next = start;                                                               //                                  //
+  for (uint8_t i=0;i<3;i++) next = getRecord(next,title);                     //                                  //
+  next = getRecord((addr-6)&mask,title);                                      // Around the record written        //
+  getRecord(next,title);                                                      //                                  //
+} // of method checkOverlap                                                   //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM read ahead test program");          //                                  //
+  const uint32_t mask = memory.SRAMBytes-1;                                   //                                  //
+  for (uint32_t i=0;i<memory.SRAMBytes;i++)                                   //                                  //
+    hostMemory.memory()[i] = i*7+(i>>8);                                      //                                  //
+  uint32_t addr = memory.SRAMBytes-300;                                       // Wraps around to address 0        //
+  hostMemory.resetCounters();                                                 //                                  //
+  for (uint8_t i=0;i<RECORDS;i++) addr = getRecord(addr,"in order");          //                                  //
+  Serial.print("Transactions for ");                                          //                                  //
+  Serial.print(RECORDS);                                                      //                                  //
+  Serial.print(" records: ");                                                 //                                  //
+  Serial.println(hostMemory.transactions);                                    //                                  //
+  hostCheck(hostMemory.transactions==6,"read ahead");                         //                                  //
+  checkOverlap(1000,1010,"put() inside the window");                          //                                  //
+  checkOverlap(2006,2008,"put() before the window");                          //                                  //
+  checkOverlap((mask-8)&mask,2,"put() across the end");                       //                                  //
+  hostMemory.resetCounters();                                                 // Random reads aren't prefetched   //
+  for (uint8_t i=0;i<50;i++) getRecord((i*997)&mask,"random");                //                                  //
+  hostCheck(hostMemory.dataBytes<=50*sizeof(Record),                          //                                  //
+            "random reads read ahead");                                       //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
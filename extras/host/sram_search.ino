@@ -0,0 +1,73 @@
+/*******************************************************************************************************************
+** Host sketch checking find() of the MicrochipSRAM library against the emulated memory. The memory is filled     **
+** with random bytes from a small alphabet so that partial matches are common, and the offsets returned by find() **
+** for single bytes and for patterns of 2 to 255 bytes, some copied from the memory and some not present, are     **
+** compared with a simple search of the emulator's memory. Searches wrap around the end of the memory.            **
+** SRAM_COPY_BYTES is set to 64 as on the AVR processors, so that patterns longer than the search window are      **
+** checked too. Each search of a pattern that fits into the window must use a single transaction. Any problem     **
+** found is shown as "FAIL" and makes the program return 1. The sketch is built like the examples, see            **
+** host_main.cpp, e.g.                                                                                            **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_search.ino"'                       **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#define SRAM_COPY_BYTES 64                                                    // Search window size used on AVR   //
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+#define SEARCHES    600                                                       // Number of random searches        //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+                                                                              //----------------------------------//
+uint32_t reference(const uint32_t addr,const uint32_t length,                 // Simple search of the emulated    //
+                   const uint8_t *pattern,const uint8_t patternLength) {      // memory giving the expected       //
+  const uint8_t *bytes = hostMemory.memory();                                 // result                           //
+  const uint32_t mask  = memory.SRAMBytes-1;                                  //                                  //
+  if (patternLength==0) return 0;                                             //                                  //
+  for (uint32_t offset=0;offset+patternLength<=length;offset++) {             //                                  //
+    uint8_t i = 0;                                                            //                                  //
+    while (i<patternLength && bytes[(addr+offset+i)&mask]==pattern[i]) i++;   //                                  //
+    if (i==patternLength) return offset;                                      //                                  //
+  } // of for-next each offset                                                //                                  //
+  return length;                                                              //                                  //
+} // of method reference                                                      //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM search test program");              //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  const uint32_t mask = memory.SRAMBytes-1;                                   //                                  //
+  srand(3);                                                                   //                                  //
+  for (uint32_t i=0;i<memory.SRAMBytes;i++) bytes[i] = 'a'+rand()%3;          // Small alphabet of 3 letters      //
+  uint32_t longFound = 0;                                                     // Long patterns found              //
+  for (uint16_t t=0;t<SEARCHES;t++) {                                         // Random searches                  //
+    const uint32_t addr   = rand()%memory.SRAMBytes;                          //                                  //
+    const uint32_t length = rand()%3000;                                      //                                  //
+    uint8_t patternLength = 1+rand()%8;                                       // Mostly short patterns, some      //
+    if (t%3==0) patternLength = 1+rand()%70;                                  // around the window size and some  //
+    if (t%10==0) patternLength = 65+rand()%191;                               // of up to 255 bytes               //
+    uint8_t pattern[255];                                                     //                                  //
+    if (rand()%2 && length>patternLength) {                                   // Copy the pattern from the memory //
+      const uint32_t offset = rand()%(length-patternLength+1);                // or make up a random one          //
+      for (uint8_t i=0;i<patternLength;i++)                                   //                                  //
+        pattern[i] = bytes[(addr+offset+i)&mask];                             //                                  //
+    } else {                                                                  //                                  //
+      for (uint8_t i=0;i<patternLength;i++) pattern[i] = 'a'+rand()%3;        //                                  //
+    } // of if-then-else pattern from memory                                  //                                  //
+    const uint32_t expected = reference(addr,length,pattern,patternLength);   //                                  //
+    if (patternLength>SRAM_COPY_BYTES && expected<length) longFound++;        //                                  //
+    hostMemory.resetCounters();                                               //                                  //
+    if (!hostCheck(memory.find(addr,length,pattern,patternLength)==expected,  //                                  //
+                   "pattern")) {                                              // Show the pattern length          //
+      Serial.print(patternLength);                                            //                                  //
+      Serial.println(" bytes");                                               //                                  //
+    } // of if-then wrong result                                              //                                  //
+    hostCheck(patternLength>SRAM_COPY_BYTES || hostMemory.transactions<=1,    // One sequential read              //
+              "more than one transaction");                                   //                                  //
+    hostCheck(memory.find(addr,length,pattern[0])==                           // Single byte                      //
+              reference(addr,length,pattern,1),"byte");                       //                                  //
+  } // of for-next each search                                                //                                  //
+  hostCheck(longFound>0,"no long pattern found");                             // Long patterns must be checked    //
+  Serial.print("Long patterns found: ");                                      //                                  //
+  Serial.println(longFound);                                                  //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
@@ -0,0 +1,78 @@
+/*******************************************************************************************************************
+** Host sketch checking the vectored getv() and putv() of the MicrochipSRAM library against the emulated memory.  **
+** Lists of up to 8 segments of random sizes are written and read back, either to adjacent memory from a start    **
+** address wrapping around the end of the memory, which must take one transaction, or at each segment's own       **
+** address, where only segments not adjacent to the previous one may start a new transaction. The memory is       **
+** compared with a copy kept in RAM, the buffers read with the data written and the returned address must follow  **
+** the last segment. Empty lists must not use the bus. Any problem found is shown as "FAIL" and makes the program **
+** return 1. The sketch is built like the examples, see host_main.cpp, e.g.                                       **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_vector.ino"'                       **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN  A5                                                       // Pin of the emulated memory       //
+#define RANDOM_TESTS 2000                                                     // Number of random lists           //
+#define SEGMENTS     8                                                        // Most segments in a list          //
+#define MAX_BYTES    100                                                      // Largest segment                  //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+static uint8_t expected[SRAM_1024];                                           // Copy of the memory in RAM        //
+static uint8_t written[SEGMENTS][MAX_BYTES];                                  // Buffers written                  //
+static uint8_t readBack[SEGMENTS][MAX_BYTES];                                 // Buffers read back                //
+                                                                              //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM vectored transfer test program");   //                                  //
+  const uint32_t mask = memory.SRAMBytes-1;                                   //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  srand(17);                                                                  //                                  //
+  for (uint32_t i=0;i<memory.SRAMBytes;i++) expected[i] = bytes[i] = rand();  //                                  //
+  SRAMConstSegment putList[SEGMENTS];                                         // Buffers only read by putv()      //
+  SRAMSegment      getList[SEGMENTS];                                         // Buffers filled by getv()         //
+  for (uint16_t t=0;t<RANDOM_TESTS;t++) {                                     //                                  //
+    const bool     ownAddress = t%2;                                          // Alternate both kinds of lists    //
+    const uint8_t  count = 1+rand()%SEGMENTS;                                 //                                  //
+    const uint32_t start = (t<20) ? mask-t*10 : rand()&mask;                  // Wrap the first ones              //
+    uint32_t addr = start, transactions = 1;                                  //                                  //
+    for (uint8_t i=0;i<count;i++) {                                           // Segments are adjacent half of    //
+      if (ownAddress && i>0 && rand()%2) {                                    // the time, and may overlap the    //
+        const uint32_t other = rand()&mask;                                   // previous ones                    //
+        if (other!=addr) transactions++;                                      //                                  //
+        addr = other;                                                         //                                  //
+      } // of if-then segment not adjacent                                    //                                  //
+      const uint32_t size = 1+rand()%MAX_BYTES;                               //                                  //
+      for (uint32_t j=0;j<size;j++)                                           //                                  //
+        expected[(addr+j)&mask] = written[i][j] = rand();                     //                                  //
+      putList[i] = {written[i],size,addr};                                    //                                  //
+      getList[i] = {readBack[i],size,addr};                                   //                                  //
+      addr = (addr+size)&mask;                                                //                                  //
+    } // of for-next each segment                                             //                                  //
+    hostMemory.resetCounters();                                               //                                  //
+    const uint32_t next = ownAddress ? memory.putv(putList,count)             //                                  //
+                                     : memory.putv(start,putList,count);      //                                  //
+    hostCheck(next==addr && hostMemory.transactions==transactions &&          //                                  //
+              memcmp(bytes,expected,memory.SRAMBytes)==0,"putv()");           //                                  //
+    hostMemory.resetCounters();                                               //                                  //
+    const uint32_t last = ownAddress ? memory.getv(getList,count)             //                                  //
+                                     : memory.getv(start,getList,count);      //                                  //
+    bool same = (last==addr && hostMemory.transactions==transactions);        //                                  //
+    for (uint8_t i=0;i<count;i++)                                             // Segments written later may       //
+      for (uint32_t j=0;j<getList[i].bytes;j++)                               // have overwritten earlier ones    //
+        same &= readBack[i][j]==expected[(getList[i].addr+j)&mask];           //                                  //
+    hostCheck(same,"getv()");                                                 //                                  //
+  } // of for-next each random test                                           //                                  //
+  hostMemory.resetCounters();                                                 // Empty lists return the address   //
+  hostCheck(memory.putv(putList,0)==0 && memory.getv(getList,0)==0 &&         // without using the bus            //
+            memory.putv(mask+8,putList,0)==7 &&                               //                                  //
+            memory.getv(5,getList,0)==5 &&                                    //                                  //
+            hostMemory.transactions==0,"empty list");                         //                                  //
+  static const uint8_t header[4] = {'H','D','R',1};                           // Constant data is written without //
+  const SRAMConstSegment constList[2] = {{header,sizeof(header),0},           // a cast                           //
+                                         {"data",4,0}};                       //                                  //
+  hostCheck(memory.putv(mask-1,constList,2)==6 && bytes[mask-1]=='H' &&       // Wraps around the end of memory   //
+            bytes[1]==1 && memcmp(bytes+2,"data",4)==0,"constant buffers");   //                                  //
+  Serial.println("Done");                                                     //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop
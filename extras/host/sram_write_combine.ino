@@ -0,0 +1,96 @@
+/*******************************************************************************************************************
+** Host sketch checking the SRAMWriteCombiner buffer of the MicrochipSRAM library against the emulated memory.    **
+** 100 log records are written one field at a time, a 4 byte time stamp, a 1 byte id and a 2 byte value, from     **
+** near the end of the memory so that they wrap around to address 0. The 300 put() calls of 700 bytes must take   **
+** 22 transactions with a buffer of 32 bytes, the counters must agree with the transactions seen by the emulator  **
+** and the records read back must be correct. Random put() calls of 2 and 80 bytes at random and consecutive      **
+** addresses are then compared with a copy of the memory kept in RAM. Any problem found is shown as "FAIL" and    **
+** makes the program return 1. The sketch is built like the examples, see host_main.cpp, e.g.                     **
+** g++ -std=gnu++11 -fpermissive -Iextras/host -I. -DSKETCH='"extras/host/sram_write_combine.ino"'                **
+** extras/host/{Arduino,SPI,SRAMEmulator,host_main}.cpp MicrochipSRAM.cpp -o sram_host && ./sram_host             **
+*******************************************************************************************************************/
+#include <MicrochipSRAM.h>                                                    // Include the SRAM library         //
+#include "HostCheck.h"                                                        // Checks counted by host_main.cpp  //
+#define SRAM_SS_PIN A5                                                        // Pin of the emulated memory       //
+#define RECORDS     100                                                       // Number of log records            //
+#define ACCESSES    5000                                                      // Number of random put() calls     //
+struct Block {                                                                // Larger than the buffer           //
+  uint8_t data[80];                                                           //                                  //
+}; // of struct Block                                                         //                                  //
+static MicrochipSRAM memory(SRAM_SS_PIN);                                     // Instantiate the memory class     //
+extern SRAMEmulator hostMemory;                                               // Emulated chip, see host_main.cpp //
+static uint8_t expected[SRAM_1024];                                           // Copy of the memory in RAM        //
+                                                                              //----------------------------------//
+void checkCounters(SRAMWriteCombiner<MicrochipSRAM,32> &combiner,             // After flush() the put() calls    //
+                   const char* title) {                                       // which didn't start a transfer    //
+  if (!hostCheck(combiner.combined==combiner.puts-combiner.writes &&          // are the transactions saved and   //
+                 combiner.writes==hostMemory.transactions,"counters"))        // the writes are those seen by     //
+    Serial.println(title);                                                    // the emulator                     //
+} // of method checkCounters                                                  //----------------------------------//
+void setup() {                                                                // Arduino standard setup method    //
+  Serial.begin(115200);                                                       // Start fast serial communications //
+  Serial.println("Starting Microchip SRAM write combining test program");     //                                  //
+  uint8_t *bytes = hostMemory.memory();                                       //                                  //
+  const uint32_t mask = memory.SRAMBytes-1;                                   //                                  //
+  {                                                                           // Combiner destroyed at block end  //
+    SRAMWriteCombiner<MicrochipSRAM,32> combiner(memory);                     //                                  //
+    uint32_t addr = memory.SRAMBytes-50;                                      // Wraps around to address 0        //
+    hostMemory.resetCounters();                                               //                                  //
+    for (uint8_t i=0;i<RECORDS;i++) {                                         // Write each field separately      //
+      addr = combiner.put(addr,(uint32_t)i*1000);                             //                                  //
+      addr = combiner.put(addr,(uint8_t)i);                                   //                                  //
+      addr = combiner.put(addr,(uint16_t)(i*3));                              //                                  //
+    } // of for-next each record                                              //                                  //
+    combiner.flush();                                                         //                                  //
+    Serial.print("put() calls: ");                                            //                                  //
+    Serial.print(combiner.puts);                                              //                                  //
+    Serial.print(", transactions: ");                                         //                                  //
+    Serial.print(combiner.writes);                                            //                                  //
+    Serial.print(", saved: ");                                                //                                  //
+    Serial.println(combiner.combined);                                        //                                  //
+    checkCounters(combiner,"of records");                                     //                                  //
+    hostCheck(combiner.puts==3*RECORDS && combiner.writes==22,                // 700 bytes in 32 byte blocks      //
+              "transactions for records");                                    //                                  //
+    addr = memory.SRAMBytes-50;                                               // Read the records back            //
+    for (uint8_t i=0;i<RECORDS;i++) {                                         //                                  //
+      uint32_t stamp;                                                         //                                  //
+      uint8_t  id;                                                            //                                  //
+      uint16_t value;                                                         //                                  //
+      addr = memory.get(addr,stamp);                                          //                                  //
+      addr = memory.get(addr,id);                                             //                                  //
+      addr = memory.get(addr,value);                                          //                                  //
+      if (!hostCheck(stamp==(uint32_t)i*1000 && id==i && value==i*3,          //                                  //
+                     "record read back")) break;                              //                                  //
+    } // of for-next each record                                              //                                  //
+    memcpy(expected,bytes,memory.SRAMBytes);                                  //                                  //
+    srand(9);                                                                 //                                  //
+    uint32_t next = 0;                                                        //                                  //
+    hostMemory.resetCounters();                                               //                                  //
+    combiner.puts = combiner.writes = combiner.combined = 0;                  //                                  //
+    for (uint16_t t=0;t<ACCESSES;t++) {                                       // Random put() calls, 4 in 5 at    //
+      const uint32_t start = (t%5==0) ? rand()&mask : next;                   // the next address                 //
+      if (rand()%4==0) {                                                      // Larger than the buffer           //
+        Block block;                                                          //                                  //
+        for (uint8_t i=0;i<sizeof(block);i++) block.data[i] = rand();         //                                  //
+        next = combiner.put(start,block);                                     //                                  //
+        for (uint8_t i=0;i<sizeof(block);i++)                                 //                                  //
+          expected[(start+i)&mask] = block.data[i];                           //                                  //
+      } else {                                                                // Small value                      //
+        const uint16_t value = rand();                                        //                                  //
+        next = combiner.put(start,value);                                     //                                  //
+        expected[start]          = value;                                     //                                  //
+        expected[(start+1)&mask] = value>>8;                                  //                                  //
+      } // of if-then-else large value                                        //                                  //
+    } // of for-next each put                                                 //                                  //
+    combiner.put(5,(uint8_t)42);                                              // Written by the destructor        //
+    expected[5] = 42;                                                         //                                  //
+    combiner.flush();                                                         //                                  //
+    checkCounters(combiner,"of random puts");                                 //                                  //
+    combiner.put(6,(uint8_t)43);                                              //                                  //
+    expected[6] = 43;                                                         //                                  //
+  } // of block using the combiner                                            //                                  //
+  hostCheck(memcmp(bytes,expected,memory.SRAMBytes)==0,                       //                                  //
+            "memory after random puts");                                      //                                  //
+} // of method setup()                                                        //----------------------------------//
+
+void loop() { while(1); } // do nothing in the main loop